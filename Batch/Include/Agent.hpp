@@ -0,0 +1,162 @@
+#pragma once
+
+#include "DistanceTable.hpp"
+#include "IGameEngine.hpp"
+#include "Random.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Pacman {
+
+    /// @brief Player controller for headless games
+    ///
+    /// Each batch worker owns one agent and reuses it for every game it plays,
+    /// so per-game state must be reset in BeginGame. Deriving everything from
+    /// the game seed keeps results independent of which worker ran the game.
+    class IAgent {
+    public:
+        virtual ~IAgent() = default;
+
+        /// @brief Called before the first tick of every game
+        /// @param seed Seed of the game about to be played
+        virtual void BeginGame(uint64_t seed) = 0;
+
+        /// @brief Direction to request for the coming tick
+        /// @param engine Engine running the game; the agent may query it freely
+        /// @param tick Ticks played so far in this game
+        virtual Direction ChooseDirection(const IGameEngine& engine, uint32_t tick) = 0;
+    };
+
+    /// @brief Picks a new random direction every few ticks
+    class RandomAgent : public IAgent {
+    public:
+        static constexpr uint32_t DefaultHoldTicks = 8;
+
+        explicit RandomAgent(uint32_t holdTicks = DefaultHoldTicks)
+            : holdTicks_(holdTicks ? holdTicks : 1) {}
+
+        void BeginGame(uint64_t seed) override {
+            rng_.Seed(seed);
+            direction_ = Direction::None;
+        }
+
+        Direction ChooseDirection(const IGameEngine&, uint32_t tick) override {
+            if (tick % holdTicks_ == 0) {
+                direction_ = static_cast<Direction>(rng_.NextInt(4));
+            }
+            return direction_;
+        }
+
+    private:
+        Random rng_;
+        uint32_t holdTicks_;
+        Direction direction_ = Direction::None;
+    };
+
+    /// @brief Replays a fixed list of directions, looping when it runs out
+    class ScriptedAgent : public IAgent {
+    public:
+        explicit ScriptedAgent(std::vector<Direction> script) : script_(std::move(script)) {}
+
+        void BeginGame(uint64_t) override {}
+
+        Direction ChooseDirection(const IGameEngine&, uint32_t tick) override {
+            return script_.empty() ? Direction::None : script_[tick % script_.size()];
+        }
+
+    private:
+        std::vector<Direction> script_;
+    };
+
+    /// @brief Heads for the nearest pellet and runs from ghosts that come close
+    ///
+    /// Distances come from the engine's player DistanceTable, so a decision
+    /// is a handful of array lookups; the nearest pellet is only searched
+    /// again once the current target has been eaten. Deterministic, so it
+    /// ignores the seed.
+    class GreedyAgent : public IAgent {
+    public:
+        /// @brief Maze steps within which a chasing ghost makes the agent flee
+        static constexpr int DangerDistance = 4;
+
+        void BeginGame(uint64_t) override {
+            target_.reset();
+        }
+
+        Direction ChooseDirection(const IGameEngine& engine, uint32_t tick) override {
+            if (tick == 0 || !table_) table_ = engine.GetDistanceTable(MazeGraph::Mover::Player);
+            Vector2 player = engine.GetPlayerState().Position;
+
+            // Only ghosts that can kill, and only when one is close
+            ghosts_.clear();
+            engine.CopyGhostStates(ghostStates_);
+            for (const GhostState& ghost : ghostStates_) {
+                if (ghost.IsEaten || ghost.IsFrightened) continue;
+                int distance = table_->GetDistance(player, ghost.Position);
+                if (distance != DistanceTable::Unreachable && distance <= DangerDistance) {
+                    ghosts_.push_back(ghost.Position);
+                }
+            }
+            if (!ghosts_.empty()) return Flee(player);
+
+            if (!target_ || *target_ == player || !IsPellet(engine.GetTileAt(*target_))) {
+                target_ = FindNearestPellet(engine, player);
+                if (!target_) return Direction::None;
+            }
+            return table_->GetNextHop(player, *target_);
+        }
+
+    private:
+        static bool IsPellet(TileType tile) {
+            return tile == TileType::Pellet || tile == TileType::PowerPellet;
+        }
+
+        std::optional<Vector2> FindNearestPellet(const IGameEngine& engine, const Vector2& player) {
+            std::optional<Vector2> nearest;
+            int best = INT32_MAX;
+            engine.CopyPelletPositions(pellets_);
+            for (const Vector2& pellet : pellets_) {
+                int distance = table_->GetDistance(player, pellet);
+                if (distance != DistanceTable::Unreachable && distance < best) {
+                    best = distance;
+                    nearest = pellet;
+                }
+            }
+            return nearest;
+        }
+
+        /// @brief The open neighbour farthest from the closest dangerous ghost
+        Direction Flee(const Vector2& player) const {
+            Direction best = Direction::None;
+            int bestDistance = -1;
+            for (Direction dir : {Direction::Up, Direction::Left, Direction::Down, Direction::Right}) {
+                Vector2 next = player + GetDirectionDelta(dir);
+                next.X = (next.X + MazeGraph::Width) % MazeGraph::Width;
+                if (table_->GetDistance(player, next) != 1) continue;
+
+                int closest = INT32_MAX;
+                for (const Vector2& ghost : ghosts_) {
+                    int distance = table_->GetDistance(next, ghost);
+                    if (distance != DistanceTable::Unreachable) closest = std::min(closest, distance);
+                }
+                if (closest > bestDistance) {
+                    bestDistance = closest;
+                    best = dir;
+                }
+            }
+            return best;
+        }
+
+        std::shared_ptr<const DistanceTable> table_;
+        std::optional<Vector2> target_;
+        std::vector<Vector2> ghosts_;
+        // Reused every call so that, once grown, choosing a move never allocates
+        std::vector<GhostState> ghostStates_;
+        std::vector<Vector2> pellets_;
+    };
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Agent.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Pacman {
+
+    /// @brief Creates the agent for one worker; called once per worker thread
+    using AgentFactory = std::function<std::unique_ptr<IAgent>()>;
+
+    struct BatchRunConfig {
+        /// @brief Games to play; game i is seeded with BaseSeed + i
+        uint32_t GameCount = 1000;
+        uint64_t BaseSeed = 1;
+        /// @brief Worker threads; 0 uses std::thread::hardware_concurrency()
+        unsigned ThreadCount = 0;
+        /// @brief Pin worker i to logical CPU i (Linux and Windows; ignored elsewhere)
+        bool PinThreads = false;
+        /// @brief Games still running after this many ticks are counted as timed out
+        uint32_t MaxTicksPerGame = 60 * 60 * 10;
+        float DeltaTime = 1.0f / 60.0f;
+        /// @brief Keep one GameResult per game in BatchReport::Results
+        bool KeepResults = false;
+    };
+
+    /// @brief Outcome of one game
+    struct GameResult {
+        uint64_t Seed = 0;
+        int Score = 0;
+        uint32_t Ticks = 0;
+        /// @brief Victory, GameOver, or Running if MaxTicksPerGame was reached
+        GameState Outcome = GameState::Running;
+        /// @brief Lives lost to each ghost, indexed by GhostType
+        std::array<uint8_t, 4> Deaths{};
+        /// @brief Lives lost with no dangerous ghost on the player's tile; Deaths plus these is every life lost
+        uint8_t UnknownDeaths = 0;
+    };
+
+    /// @brief Per-worker counters, for spotting imbalance
+    struct WorkerReport {
+        uint64_t Games = 0;
+        uint64_t Ticks = 0;
+        uint64_t Steals = 0;
+        double BusySeconds = 0.0;
+    };
+
+    struct BatchReport {
+        uint64_t Games = 0;
+        uint64_t Victories = 0;
+        uint64_t GameOvers = 0;
+        uint64_t TimedOut = 0;
+        uint64_t Ticks = 0;
+        int64_t TotalScore = 0;
+        std::array<uint64_t, 4> DeathsByGhost{};
+        uint64_t UnknownDeaths = 0;
+
+        double WallSeconds = 0.0;
+        double GamesPerSecond = 0.0;
+        double TicksPerSecond = 0.0;
+
+        unsigned ThreadCount = 0;
+        /// @brief False if pinning was requested but at least one thread could not be pinned
+        bool Pinned = false;
+        std::vector<WorkerReport> Workers;
+        /// @brief Indexed by game; empty unless BatchRunConfig::KeepResults
+        std::vector<GameResult> Results;
+    };
+
+    /// @brief Play config.GameCount complete games across a work-stealing thread pool
+    ///
+    /// Game lengths vary by orders of magnitude, so each worker starts with an
+    /// equal share of game indices and, once its share runs dry, steals half
+    /// of another worker's remainder. Every worker owns one engine, one agent
+    /// and its counters in cache-line-aligned storage it alone writes, and
+    /// starts each game by restoring a fresh-game snapshot reseeded for that
+    /// game, so the runner allocates nothing per game; agents keep it that way
+    /// by reading the engine through its Copy accessors into buffers they
+    /// own, as GreedyAgent does. A game's result depends only on its seed
+    /// and the agent, never on the thread count or which worker played it.
+    BatchReport RunBatch(const BatchRunConfig& config, const AgentFactory& makeAgent);
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace Pacman {
+
+    /// @brief Fixed line size used to keep per-worker data apart
+    ///
+    /// std::hardware_destructive_interference_size is not reliably available
+    /// and varies between compiler flags; 64 bytes matches x86-64 and most ARM cores.
+    inline constexpr std::size_t CacheLineSize = 64;
+
+    /// @brief Half-open range of job indices owned by one worker and open to theft
+    ///
+    /// Begin and end share one 64-bit word, so the owner taking from the front
+    /// and thieves taking the back half are both a single compare-exchange and
+    /// never lose or repeat an index. Sits alone on its cache line because
+    /// every steal attempt touches it.
+    class alignas(CacheLineSize) WorkStealingRange {
+    public:
+        /// @brief Stolen block [Begin, End)
+        struct Block {
+            uint32_t Begin = 0;
+            uint32_t End = 0;
+        };
+
+        /// @brief Replace the range; only the owner calls this, and only while it is empty
+        void Reset(uint32_t begin, uint32_t end) {
+            range_.store(Pack(begin, end), std::memory_order_release);
+        }
+
+        /// @brief Owner side: take the next index from the front
+        std::optional<uint32_t> Pop() {
+            uint64_t current = range_.load(std::memory_order_acquire);
+            while (Begin(current) < End(current)) {
+                if (range_.compare_exchange_weak(current, Pack(Begin(current) + 1, End(current)),
+                                                 std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    return Begin(current);
+                }
+            }
+            return std::nullopt;
+        }
+
+        /// @brief Thief side: take the back half (rounded up) of what is left
+        std::optional<Block> Steal() {
+            uint64_t current = range_.load(std::memory_order_acquire);
+            while (Begin(current) < End(current)) {
+                uint32_t remaining = End(current) - Begin(current);
+                uint32_t split = End(current) - (remaining + 1) / 2;
+                if (range_.compare_exchange_weak(current, Pack(Begin(current), split),
+                                                 std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    return Block{split, End(current)};
+                }
+            }
+            return std::nullopt;
+        }
+
+        /// @brief Indices not yet taken; a snapshot that may be stale immediately
+        uint32_t GetRemaining() const {
+            uint64_t current = range_.load(std::memory_order_relaxed);
+            return End(current) - Begin(current);
+        }
+
+    private:
+        static constexpr uint64_t Pack(uint32_t begin, uint32_t end) {
+            return (static_cast<uint64_t>(end) << 32) | begin;
+        }
+        static constexpr uint32_t Begin(uint64_t range) { return static_cast<uint32_t>(range); }
+        static constexpr uint32_t End(uint64_t range) { return static_cast<uint32_t>(range >> 32); }
+
+        std::atomic<uint64_t> range_{0};
+    };
+
+    static_assert(sizeof(WorkStealingRange) == CacheLineSize);
+
+}
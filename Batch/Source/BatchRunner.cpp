@@ -0,0 +1,244 @@
+#include "BatchRunner.hpp"
+#include "WorkStealingRange.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace Pacman {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief Attributes each lost life to the ghost standing on the player
+        ///
+        /// The engine reports the death before it resets positions, so the last
+        /// ghost update still shows the collision. A life that cannot be
+        /// attributed is still counted, as unknown, so nothing goes missing.
+        class DeathTracker : public IEventListener {
+        public:
+            void BeginGame(int lives, const std::array<GhostState, 4>& ghosts) {
+                lives_ = lives;
+                ghosts_ = ghosts;
+                deaths_ = {};
+                unknownDeaths_ = 0;
+            }
+
+            const std::array<uint8_t, 4>& GetDeaths() const { return deaths_; }
+            uint8_t GetUnknownDeaths() const { return unknownDeaths_; }
+
+            void OnTileUpdated(const TileUpdate&) override {}
+            void OnGameStateChanged(GameState) override {}
+
+            void OnPlayerStateChanged(const PlayerState& state) override {
+                for (int lost = lives_ - state.Lives; lost > 0; --lost) {
+                    auto killer = std::find_if(ghosts_.begin(), ghosts_.end(), [&](const GhostState& ghost) {
+                        return ghost.Position == state.Position && !ghost.IsEaten && !ghost.IsFrightened;
+                    });
+                    if (killer != ghosts_.end()) {
+                        ++deaths_[static_cast<size_t>(killer->Type)];
+                    } else {
+                        ++unknownDeaths_;
+                    }
+                }
+                lives_ = state.Lives;
+            }
+
+            void OnGhostsUpdated(std::span<const GhostState> ghosts) override {
+                std::copy(ghosts.begin(), ghosts.end(), ghosts_.begin());
+            }
+
+        private:
+            int lives_ = 0;
+            std::array<GhostState, 4> ghosts_{};
+            std::array<uint8_t, 4> deaths_{};
+            uint8_t unknownDeaths_ = 0;
+        };
+
+        struct Tally {
+            uint64_t Victories = 0;
+            uint64_t GameOvers = 0;
+            uint64_t TimedOut = 0;
+            int64_t TotalScore = 0;
+            std::array<uint64_t, 4> DeathsByGhost{};
+            uint64_t UnknownDeaths = 0;
+        };
+
+        /// @brief Everything one worker touches; the range is read by thieves,
+        /// the rest only by the owning thread
+        struct alignas(CacheLineSize) Worker {
+            WorkStealingRange Range;
+            std::shared_ptr<IGameEngine> Engine;
+            std::unique_ptr<IAgent> Agent;
+            std::shared_ptr<DeathTracker> Deaths;
+            EngineSnapshot FreshGame{};
+            WorkerReport Report;
+            Tally Totals;
+        };
+
+        bool PinCurrentThread(unsigned cpu) {
+#if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu % CPU_SETSIZE, &set);
+            return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif defined(_WIN32)
+            // Without processor groups only the first 64 CPUs are addressable
+            if (cpu >= 64) return false;
+            return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#else
+            (void)cpu;
+            return false;
+#endif
+        }
+
+        GameResult PlayGame(Worker& worker, uint64_t seed, const BatchRunConfig& config) {
+            // Same state as CreateGameEngine(seed) followed by StartNewGame, without allocating
+            worker.FreshGame.Seed = seed;
+            worker.FreshGame.Rng.Seed(seed);
+            IGameEngine& engine = *worker.Engine;
+            engine.RestoreSnapshot(worker.FreshGame);
+            worker.Deaths->BeginGame(worker.FreshGame.Player.Lives, worker.FreshGame.Ghosts);
+            worker.Agent->BeginGame(seed);
+
+            uint32_t tick = 0;
+            while (tick < config.MaxTicksPerGame && engine.GetState() == GameState::Running) {
+                engine.SetPlayerDirection(worker.Agent->ChooseDirection(engine, tick));
+                engine.Update(config.DeltaTime);
+                ++tick;
+            }
+
+            GameResult result;
+            result.Seed = seed;
+            result.Score = engine.GetPlayerState().Score;
+            result.Ticks = tick;
+            result.Outcome = engine.GetState();
+            result.Deaths = worker.Deaths->GetDeaths();
+            result.UnknownDeaths = worker.Deaths->GetUnknownDeaths();
+            return result;
+        }
+
+        void Record(Worker& worker, const GameResult& result) {
+            Tally& totals = worker.Totals;
+            switch (result.Outcome) {
+                case GameState::Victory: ++totals.Victories; break;
+                case GameState::GameOver: ++totals.GameOvers; break;
+                default: ++totals.TimedOut; break;
+            }
+            totals.TotalScore += result.Score;
+            for (size_t i = 0; i < result.Deaths.size(); ++i) {
+                totals.DeathsByGhost[i] += result.Deaths[i];
+            }
+            totals.UnknownDeaths += result.UnknownDeaths;
+            ++worker.Report.Games;
+            worker.Report.Ticks += result.Ticks;
+        }
+
+        /// @brief Take half of the first non-empty range after our own
+        std::optional<WorkStealingRange::Block> StealWork(std::vector<Worker>& workers, size_t self) {
+            for (size_t offset = 1; offset < workers.size(); ++offset) {
+                auto block = workers[(self + offset) % workers.size()].Range.Steal();
+                if (block) return block;
+            }
+            return std::nullopt;
+        }
+
+        void RunWorker(std::vector<Worker>& workers, size_t self, const BatchRunConfig& config,
+                       const AgentFactory& makeAgent, std::vector<GameResult>& results) {
+            Worker& worker = workers[self];
+            // Built on the worker thread so the memory is local to the core that uses it
+            worker.Engine = CreateGameEngine(config.BaseSeed);
+            worker.Engine->StartNewGame();
+            worker.Engine->SaveSnapshot(worker.FreshGame);
+            worker.Deaths = std::make_shared<DeathTracker>();
+            worker.Engine->AddListener(worker.Deaths);
+            worker.Agent = makeAgent();
+
+            auto start = Clock::now();
+            for (;;) {
+                std::optional<uint32_t> index = worker.Range.Pop();
+                if (!index) {
+                    // Nothing is ever added back, so a full fruitless sweep means we are done
+                    auto block = StealWork(workers, self);
+                    if (!block) break;
+                    ++worker.Report.Steals;
+                    worker.Range.Reset(block->Begin + 1, block->End);
+                    index = block->Begin;
+                }
+
+                GameResult result = PlayGame(worker, config.BaseSeed + *index, config);
+                Record(worker, result);
+                if (config.KeepResults) results[*index] = result;
+            }
+            worker.Report.BusySeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+            worker.Engine->RemoveListener(worker.Deaths);
+        }
+
+    }
+
+    BatchReport RunBatch(const BatchRunConfig& config, const AgentFactory& makeAgent) {
+        BatchReport report;
+        unsigned threadCount = config.ThreadCount ? config.ThreadCount : std::thread::hardware_concurrency();
+        threadCount = std::max(1u, threadCount);
+        report.ThreadCount = threadCount;
+        if (config.KeepResults) report.Results.resize(config.GameCount);
+
+        // Equal contiguous shares to start with; stealing evens out the rest
+        std::vector<Worker> workers(threadCount);
+        for (unsigned i = 0; i < threadCount; ++i) {
+            auto begin = static_cast<uint32_t>(uint64_t{config.GameCount} * i / threadCount);
+            auto end = static_cast<uint32_t>(uint64_t{config.GameCount} * (i + 1) / threadCount);
+            workers[i].Range.Reset(begin, end);
+        }
+
+        unsigned cpuCount = std::max(1u, std::thread::hardware_concurrency());
+        std::atomic<bool> allPinned{true};
+
+        auto start = Clock::now();
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&, i] {
+                if (config.PinThreads && !PinCurrentThread(i % cpuCount)) {
+                    allPinned.store(false, std::memory_order_relaxed);
+                }
+                RunWorker(workers, i, config, makeAgent, report.Results);
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        report.WallSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+        report.Pinned = config.PinThreads && allPinned.load();
+
+        for (const Worker& worker : workers) {
+            report.Workers.push_back(worker.Report);
+            report.Games += worker.Report.Games;
+            report.Ticks += worker.Report.Ticks;
+            report.Victories += worker.Totals.Victories;
+            report.GameOvers += worker.Totals.GameOvers;
+            report.TimedOut += worker.Totals.TimedOut;
+            report.TotalScore += worker.Totals.TotalScore;
+            for (size_t i = 0; i < report.DeathsByGhost.size(); ++i) {
+                report.DeathsByGhost[i] += worker.Totals.DeathsByGhost[i];
+            }
+            report.UnknownDeaths += worker.Totals.UnknownDeaths;
+        }
+        if (report.WallSeconds > 0.0) {
+            report.GamesPerSecond = static_cast<double>(report.Games) / report.WallSeconds;
+            report.TicksPerSecond = static_cast<double>(report.Ticks) / report.WallSeconds;
+        }
+        return report;
+    }
+
+}
@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    void PrintUsage() {
+        std::cout <<
+            "Usage: PacmanCompare BASELINE CURRENT [--threshold PERCENT]\n"
+            "  Compares two PacmanThroughput or CosmicBenchmarks JSON result files and\n"
+            "  flags every entry whose throughput dropped by more than PERCENT\n"
+            "  (default 5). Both files must come from the same tool. Exits with 1 if\n"
+            "  anything regressed or is missing from CURRENT.\n";
+    }
+
+    /// @brief Tool that wrote a result file, told apart by its top-level array
+    enum class ResultKind {
+        Unknown,
+        Throughput,
+        GoogleBenchmark
+    };
+
+    const char* GetKindName(ResultKind kind) {
+        switch (kind) {
+            case ResultKind::Throughput: return "PacmanThroughput";
+            case ResultKind::GoogleBenchmark: return "Google Benchmark";
+            default: return "unknown";
+        }
+    }
+
+    /// @brief Throughput of one named entry; higher is better
+    struct Entry {
+        double Rate = 0.0;
+        /// @brief Simulated ticks, when the file has them; a change means the games themselves changed
+        std::optional<double> Ticks;
+        int Samples = 0;
+    };
+
+    /// @brief Reader for the flat result objects both tools write
+    ///
+    /// Handles exactly what appears in those files: objects, arrays, strings
+    /// without escapes other than \", numbers, true/false/null. Result
+    /// objects are taken from the top-level "results" (PacmanThroughput) or
+    /// "benchmarks" (Google Benchmark) array; everything else is skipped.
+    class ResultReader {
+    public:
+        explicit ResultReader(std::string text) : text_(std::move(text)) {}
+
+        bool Read(std::map<std::string, Entry>& entries, ResultKind& kind) {
+            SkipSpace();
+            if (!Consume('{')) return false;
+            while (!Consume('}')) {
+                std::string key;
+                if (!ReadString(key) || !Consume(':')) return false;
+                if (key == "results" || key == "benchmarks") {
+                    kind = key == "results" ? ResultKind::Throughput : ResultKind::GoogleBenchmark;
+                    if (!ReadResults(entries)) return false;
+                } else if (!SkipValue()) {
+                    return false;
+                }
+                Consume(',');
+            }
+            return kind != ResultKind::Unknown;
+        }
+
+    private:
+        using Fields = std::map<std::string, std::string>;
+
+        bool ReadResults(std::map<std::string, Entry>& entries) {
+            if (!Consume('[')) return false;
+            while (!Consume(']')) {
+                Fields fields;
+                if (!ReadFlatObject(fields)) return false;
+                Add(fields, entries);
+                Consume(',');
+            }
+            return true;
+        }
+
+        static std::optional<double> Number(const Fields& fields, const std::string& key) {
+            auto it = fields.find(key);
+            if (it == fields.end()) return std::nullopt;
+            double value = 0.0;
+            auto [ptr, error] = std::from_chars(it->second.data(), it->second.data() + it->second.size(), value);
+            if (error != std::errc()) return std::nullopt;
+            return value;
+        }
+
+        static void Add(const Fields& fields, std::map<std::string, Entry>& entries) {
+            auto name = fields.find("name");
+            // Google Benchmark aggregates repeat what the individual runs already say
+            auto runType = fields.find("run_type");
+            if (name == fields.end() || (runType != fields.end() && runType->second == "aggregate")) return;
+
+            std::optional<double> rate = Number(fields, "games_per_second");
+            if (!rate) rate = Number(fields, "items_per_second");
+            if (!rate) {
+                if (auto time = Number(fields, "real_time"); time && *time > 0.0) rate = 1.0 / *time;
+            }
+            if (!rate) return;
+
+            // Repetitions of one benchmark are averaged
+            Entry& entry = entries[name->second];
+            entry.Rate = (entry.Rate * entry.Samples + *rate) / (entry.Samples + 1);
+            ++entry.Samples;
+            entry.Ticks = Number(fields, "ticks");
+        }
+
+        bool ReadFlatObject(Fields& fields) {
+            if (!Consume('{')) return false;
+            while (!Consume('}')) {
+                std::string key;
+                std::string value;
+                if (!ReadString(key) || !Consume(':')) return false;
+                SkipSpace();
+                if (Peek() == '"') {
+                    if (!ReadString(value)) return false;
+                } else if (Peek() == '{' || Peek() == '[') {
+                    if (!SkipValue()) return false;
+                } else {
+                    while (pos_ < text_.size() && text_[pos_] != ',' && text_[pos_] != '}' &&
+                           !std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+                        value += text_[pos_++];
+                    }
+                }
+                fields[key] = value;
+                Consume(',');
+            }
+            return true;
+        }
+
+        bool SkipValue() {
+            SkipSpace();
+            char c = Peek();
+            if (c == '"') {
+                std::string ignored;
+                return ReadString(ignored);
+            }
+            if (c == '{' || c == '[') {
+                char close = c == '{' ? '}' : ']';
+                ++pos_;
+                while (!Consume(close)) {
+                    if (pos_ >= text_.size()) return false;
+                    if (c == '{') {
+                        std::string key;
+                        if (!ReadString(key) || !Consume(':')) return false;
+                    }
+                    if (!SkipValue()) return false;
+                    Consume(',');
+                }
+                return true;
+            }
+            size_t start = pos_;
+            while (pos_ < text_.size() && text_[pos_] != ',' && text_[pos_] != '}' && text_[pos_] != ']' &&
+                   !std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+                ++pos_;
+            }
+            return pos_ > start;
+        }
+
+        bool ReadString(std::string& out) {
+            SkipSpace();
+            if (!Consume('"')) return false;
+            while (pos_ < text_.size() && text_[pos_] != '"') {
+                if (text_[pos_] == '\\' && pos_ + 1 < text_.size()) ++pos_;
+                out += text_[pos_++];
+            }
+            return Consume('"');
+        }
+
+        bool Consume(char c) {
+            SkipSpace();
+            if (Peek() != c) return false;
+            ++pos_;
+            return true;
+        }
+
+        char Peek() const { return pos_ < text_.size() ? text_[pos_] : '\0'; }
+
+        void SkipSpace() {
+            while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) ++pos_;
+        }
+
+        std::string text_;
+        size_t pos_ = 0;
+    };
+
+    bool Load(const std::string& path, std::map<std::string, Entry>& entries, ResultKind& kind) {
+        std::ifstream in(path);
+        if (!in) {
+            std::cerr << "Error: Cannot read " << path << '\n';
+            return false;
+        }
+        std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (!ResultReader(std::move(text)).Read(entries, kind)) {
+            std::cerr << "Error: " << path << " is not a result file\n";
+            return false;
+        }
+        return true;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> paths;
+    double threshold = 5.0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            PrintUsage();
+            return 0;
+        } else if (arg == "--threshold" && i + 1 < argc) {
+            std::string_view value = argv[++i];
+            auto [ptr, error] = std::from_chars(value.data(), value.data() + value.size(), threshold);
+            if (error != std::errc() || ptr != value.data() + value.size() || threshold < 0.0) {
+                std::cerr << "Invalid threshold: " << value << '\n';
+                return 2;
+            }
+        } else if (!arg.starts_with("--")) {
+            paths.emplace_back(arg);
+        } else {
+            std::cerr << "Invalid argument: " << arg << '\n';
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (paths.size() != 2) {
+        PrintUsage();
+        return 2;
+    }
+
+    std::map<std::string, Entry> baseline;
+    std::map<std::string, Entry> current;
+    ResultKind baselineKind = ResultKind::Unknown;
+    ResultKind currentKind = ResultKind::Unknown;
+    if (!Load(paths[0], baseline, baselineKind) || !Load(paths[1], current, currentKind)) return 2;
+    if (baselineKind != currentKind) {
+        std::cerr << "Error: " << paths[0] << " is a " << GetKindName(baselineKind) << " file but " << paths[1]
+                  << " is a " << GetKindName(currentKind) << " file\n";
+        return 2;
+    }
+
+    size_t width = 10;
+    for (const auto& [name, entry] : baseline) width = std::max(width, name.size());
+
+    int regressions = 0;
+    int missing = 0;
+    std::cout << std::fixed;
+    for (const auto& [name, base] : baseline) {
+        std::cout << std::left << std::setw(static_cast<int>(width)) << name << std::right;
+        auto it = current.find(name);
+        if (it == current.end()) {
+            std::cout << "  MISSING from " << paths[1] << '\n';
+            ++missing;
+            continue;
+        }
+        const Entry& now = it->second;
+        double change = base.Rate > 0.0 ? (now.Rate / base.Rate - 1.0) * 100.0 : 0.0;
+        std::cout << std::setprecision(1) << std::showpos << std::setw(9) << change << '%' << std::noshowpos;
+        if (change < -threshold) {
+            std::cout << "  REGRESSION";
+            ++regressions;
+        }
+        if (base.Ticks && now.Ticks && *base.Ticks != *now.Ticks) {
+            std::cout << "  (different games: " << std::setprecision(0) << *base.Ticks << " -> " << *now.Ticks
+                      << " ticks)";
+        }
+        std::cout << '\n';
+    }
+    for (const auto& [name, entry] : current) {
+        if (!baseline.contains(name)) std::cout << std::left << std::setw(static_cast<int>(width)) << name << "  new\n";
+    }
+
+    std::cout << regressions << " regression" << (regressions == 1 ? "" : "s") << " above "
+              << std::setprecision(1) << threshold << "%, " << missing << " missing\n";
+    return regressions || missing ? 1 : 0;
+}
@@ -0,0 +1,160 @@
+#include "BatchRunner.hpp"
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace {
+
+    using namespace Pacman;
+
+    void PrintUsage() {
+        std::cout <<
+            "Usage: PacmanBatch [options]\n"
+            "  --games N        games to play (default 1000)\n"
+            "  --threads N      worker threads, 0 = all cores (default 0)\n"
+            "  --seed N         seed of the first game; game i uses seed + i (default 1)\n"
+            "  --max-ticks N    stop a game after N ticks and count it as timed out (default 36000)\n"
+            "  --agent NAME     random, greedy, idle or a script of U/D/L/R letters, one per tick (default random)\n"
+            "  --hold N         ticks the random agent keeps a direction (default 8)\n"
+            "  --pin            pin worker i to CPU i\n"
+            "  --csv FILE       write one line per game to FILE\n";
+    }
+
+    template <typename T>
+    bool ParseNumber(const char* text, T& value) {
+        const char* end = text + std::strlen(text);
+        auto [ptr, error] = std::from_chars(text, end, value);
+        return error == std::errc() && ptr == end;
+    }
+
+    bool ParseScript(std::string_view text, std::vector<Direction>& script) {
+        for (char c : text) {
+            switch (c) {
+                case 'U': script.push_back(Direction::Up); break;
+                case 'D': script.push_back(Direction::Down); break;
+                case 'L': script.push_back(Direction::Left); break;
+                case 'R': script.push_back(Direction::Right); break;
+                default: return false;
+            }
+        }
+        return !script.empty();
+    }
+
+    const char* OutcomeName(GameState state) {
+        switch (state) {
+            case GameState::Victory: return "victory";
+            case GameState::GameOver: return "gameover";
+            default: return "timeout";
+        }
+    }
+
+    bool WriteCsv(const std::string& path, const BatchReport& report) {
+        std::ofstream out(path);
+        if (!out) return false;
+        out << "seed,score,ticks,outcome,deaths_red,deaths_pink,deaths_blue,deaths_orange,deaths_unknown\n";
+        for (const GameResult& result : report.Results) {
+            out << result.Seed << ',' << result.Score << ',' << result.Ticks << ','
+                << OutcomeName(result.Outcome);
+            for (uint8_t deaths : result.Deaths) out << ',' << static_cast<int>(deaths);
+            out << ',' << static_cast<int>(result.UnknownDeaths);
+            out << '\n';
+        }
+        return static_cast<bool>(out);
+    }
+
+    void PrintReport(const BatchReport& report) {
+        std::cout << std::fixed << std::setprecision(1)
+                  << "games:       " << report.Games << " on " << report.ThreadCount << " threads"
+                  << (report.Pinned ? " (pinned)" : "") << '\n'
+                  << "outcomes:    " << report.Victories << " victories, " << report.GameOvers
+                  << " game overs, " << report.TimedOut << " timed out\n"
+                  << "mean score:  " << (report.Games ? static_cast<double>(report.TotalScore) / report.Games : 0.0) << '\n'
+                  << "mean ticks:  " << (report.Games ? static_cast<double>(report.Ticks) / report.Games : 0.0) << '\n'
+                  << "deaths:     ";
+        for (size_t i = 0; i < report.DeathsByGhost.size(); ++i) {
+            std::cout << ' ' << GetGhostName(static_cast<GhostType>(i)) << ' ' << report.DeathsByGhost[i];
+        }
+        std::cout << " unknown " << report.UnknownDeaths << '\n'
+                  << std::setprecision(3) << "wall time:   " << report.WallSeconds << " s\n"
+                  << std::setprecision(0) << "games/sec:   " << report.GamesPerSecond << '\n'
+                  << "ticks/sec:   " << report.TicksPerSecond << '\n';
+
+        uint64_t steals = 0;
+        for (const WorkerReport& worker : report.Workers) steals += worker.Steals;
+        std::cout << "steals:      " << steals << '\n';
+    }
+
+}
+
+int main(int argc, char** argv) {
+    BatchRunConfig config;
+    std::string agentName = "random";
+    uint32_t holdTicks = RandomAgent::DefaultHoldTicks;
+    std::string csvPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool ok = true;
+        if (arg == "--pin") {
+            config.PinThreads = true;
+            continue;
+        } else if (arg == "--help" || arg == "-h") {
+            PrintUsage();
+            return 0;
+        } else if (!value) {
+            ok = false;
+        } else if (arg == "--games") {
+            ok = ParseNumber(value, config.GameCount);
+        } else if (arg == "--threads") {
+            ok = ParseNumber(value, config.ThreadCount);
+        } else if (arg == "--seed") {
+            ok = ParseNumber(value, config.BaseSeed);
+        } else if (arg == "--max-ticks") {
+            ok = ParseNumber(value, config.MaxTicksPerGame);
+        } else if (arg == "--hold") {
+            ok = ParseNumber(value, holdTicks);
+        } else if (arg == "--agent") {
+            agentName = value;
+        } else if (arg == "--csv") {
+            csvPath = value;
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            std::cerr << "Invalid argument: " << arg << '\n';
+            PrintUsage();
+            return 1;
+        }
+        ++i;
+    }
+
+    AgentFactory makeAgent;
+    std::vector<Direction> script;
+    if (agentName == "random") {
+        makeAgent = [holdTicks] { return std::make_unique<RandomAgent>(holdTicks); };
+    } else if (agentName == "greedy") {
+        makeAgent = [] { return std::make_unique<GreedyAgent>(); };
+    } else if (agentName == "idle") {
+        makeAgent = [] { return std::make_unique<ScriptedAgent>(std::vector<Direction>{Direction::None}); };
+    } else if (ParseScript(agentName, script)) {
+        makeAgent = [script] { return std::make_unique<ScriptedAgent>(script); };
+    } else {
+        std::cerr << "Unknown agent: " << agentName << '\n';
+        return 1;
+    }
+
+    config.KeepResults = !csvPath.empty();
+    BatchReport report = RunBatch(config, makeAgent);
+    PrintReport(report);
+
+    if (!csvPath.empty() && !WriteCsv(csvPath, report)) {
+        std::cerr << "Error: Failed to write " << csvPath << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,182 @@
+#include "Agent.hpp"
+#include "LevelPack.hpp"
+#include "ReplayPlayer.hpp"
+#include "ReplayRecorder.hpp"
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace {
+
+    using namespace Pacman;
+
+    void PrintUsage() {
+        std::cout <<
+            "Usage: PacmanReplay FILE [--pack PACK] [--seek TICK]\n"
+            "       PacmanReplay --record FILE [--games N] [--seed N] [--hold N]\n"
+            "  Without --record, re-simulates every game in FILE and checks it ends\n"
+            "  exactly as recorded; with --seek, shows each game at TICK instead,\n"
+            "  starting from the nearest keyframe. With --record, plays games with\n"
+            "  the random agent and records them to FILE.\n";
+    }
+
+    template <typename T>
+    bool ParseNumber(const char* text, T& value) {
+        const char* end = text + std::strlen(text);
+        auto [ptr, error] = std::from_chars(text, end, value);
+        return error == std::errc() && ptr == end;
+    }
+
+    const char* StateName(GameState state) {
+        switch (state) {
+            case GameState::Running: return "running";
+            case GameState::Paused: return "paused";
+            case GameState::GameOver: return "game over";
+            case GameState::Victory: return "victory";
+        }
+        return "?";
+    }
+
+    int Record(const std::string& path, uint32_t games, uint64_t seed, uint32_t holdTicks) {
+        auto recorder = std::make_shared<ReplayRecorder>(path);
+        if (!recorder->IsOpen()) {
+            std::cerr << "Error: Cannot create " << path << '\n';
+            return 1;
+        }
+        RandomAgent agent(holdTicks);
+        uint64_t ticks = 0;
+        for (uint32_t i = 0; i < games; ++i) {
+            auto engine = CreateGameEngine(seed + i);
+            engine->AddListener(recorder);
+            engine->StartNewGame();
+            agent.BeginGame(seed + i);
+            uint32_t tick = 0;
+            while (engine->GetState() == GameState::Running) {
+                engine->SetPlayerDirection(agent.ChooseDirection(*engine, tick++));
+                engine->Update(ReplayPlayer::DefaultDeltaTime);
+            }
+            ticks += tick;
+            engine->RemoveListener(recorder);
+        }
+        recorder.reset();
+
+        auto bytes = std::filesystem::file_size(path);
+        std::cout << "recorded " << games << " games, " << ticks << " ticks, " << bytes << " bytes ("
+                  << (ticks ? static_cast<double>(bytes) * 36000.0 / static_cast<double>(ticks) : 0.0)
+                  << " bytes per 10 minutes of play)\n";
+        return 0;
+    }
+
+    int Play(const std::string& path, std::shared_ptr<const LevelPack> pack, std::optional<uint32_t> seekTick) {
+        std::vector<Replay> replays = LoadReplays(path);
+        if (replays.empty()) {
+            std::cerr << "Error: No games in " << path << '\n';
+            return 1;
+        }
+
+        int mismatches = 0;
+        for (size_t i = 0; i < replays.size(); ++i) {
+            ReplayPlayer player(std::move(replays[i]), pack);
+            if (!player.IsValid()) {
+                std::cerr << "game " << i << ": level " << player.GetReplay().LevelIndex << " is not in the pack\n";
+                ++mismatches;
+                continue;
+            }
+            if (seekTick) {
+                player.SeekTo(*seekTick);
+            } else {
+                player.RunToEnd();
+            }
+
+            const IGameEngine& engine = player.GetEngine();
+            PlayerState state = engine.GetPlayerState();
+            std::cout << "game " << i << ": seed " << player.GetReplay().Seed
+                      << ", " << player.GetTick() << " ticks, " << StateName(engine.GetState())
+                      << ", score " << state.Score << ", lives " << state.Lives
+                      << ", pellets left " << engine.GetPelletCount();
+            if (seekTick) {
+                std::cout << " (" << player.GetTicksSimulated() << " ticks simulated, "
+                          << player.GetReplay().Keyframes.size() << " keyframes)\n";
+            } else if (!player.GetReplay().End) {
+                std::cout << " (recording cut short)\n";
+            } else if (player.MatchesRecordedEnd()) {
+                std::cout << " (matches)\n";
+            } else {
+                std::cout << " (MISMATCH)\n";
+                ++mismatches;
+            }
+        }
+        return mismatches ? 1 : 0;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    std::string file;
+    std::string packPath;
+    bool record = false;
+    uint32_t games = 1;
+    uint64_t seed = 1;
+    uint32_t holdTicks = RandomAgent::DefaultHoldTicks;
+    std::optional<uint32_t> seekTick;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool ok = true;
+        if (arg == "--help" || arg == "-h") {
+            PrintUsage();
+            return 0;
+        } else if (arg.starts_with("--") && !value) {
+            ok = false;
+        } else if (arg == "--record") {
+            record = true;
+            file = value;
+            ++i;
+        } else if (arg == "--pack") {
+            packPath = value;
+            ++i;
+        } else if (arg == "--games") {
+            ok = ParseNumber(value, games);
+            ++i;
+        } else if (arg == "--seed") {
+            ok = ParseNumber(value, seed);
+            ++i;
+        } else if (arg == "--hold") {
+            ok = ParseNumber(value, holdTicks);
+            ++i;
+        } else if (arg == "--seek") {
+            ok = ParseNumber(value, seekTick.emplace());
+            ++i;
+        } else if (!arg.starts_with("--") && file.empty()) {
+            file = arg;
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            std::cerr << "Invalid argument: " << arg << '\n';
+            PrintUsage();
+            return 1;
+        }
+    }
+    if (file.empty()) {
+        PrintUsage();
+        return 1;
+    }
+
+    if (record) return Record(file, games, seed, holdTicks);
+
+    std::shared_ptr<const LevelPack> pack = LevelPack::BuiltIn();
+    if (!packPath.empty()) {
+        pack = LevelPack::Open(packPath);
+        if (!pack) {
+            std::cerr << "Error: Cannot open level pack " << packPath << '\n';
+            return 1;
+        }
+    }
+    return Play(file, pack, seekTick);
+}
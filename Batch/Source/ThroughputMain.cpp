@@ -0,0 +1,193 @@
+#include "BatchRunner.hpp"
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    using namespace Pacman;
+
+    constexpr int FormatVersion = 1;
+
+    void PrintUsage() {
+        std::cout <<
+            "Usage: PacmanThroughput [options]\n"
+            "  Plays complete headless games with each agent on 1, N/2 and N threads\n"
+            "  (N = hardware threads) and reports games per second.\n"
+            "  --games N        games per run (default 2000)\n"
+            "  --seed N         seed of the first game (default 1)\n"
+            "  --repetitions N  runs per configuration; the median is reported (default 3)\n"
+            "  --agents LIST    comma-separated agents: random, greedy (default random,greedy)\n"
+            "  --threads LIST   comma-separated thread counts instead of 1, N/2, N\n"
+            "  --out FILE       write the results as JSON to FILE\n"
+            "Compare two result files with PacmanCompare.\n";
+    }
+
+    template <typename T>
+    bool ParseNumber(std::string_view text, T& value) {
+        auto [ptr, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc() && ptr == text.data() + text.size();
+    }
+
+    std::vector<std::string_view> Split(std::string_view text) {
+        std::vector<std::string_view> parts;
+        while (!text.empty()) {
+            size_t comma = text.find(',');
+            parts.push_back(text.substr(0, comma));
+            if (comma == std::string_view::npos) break;
+            text.remove_prefix(comma + 1);
+        }
+        return parts;
+    }
+
+    AgentFactory MakeAgentFactory(std::string_view name) {
+        if (name == "random") return [] { return std::make_unique<RandomAgent>(); };
+        if (name == "greedy") return [] { return std::make_unique<GreedyAgent>(); };
+        return {};
+    }
+
+    /// @brief One agent and thread count, measured over several repetitions
+    struct Measurement {
+        std::string Agent;
+        unsigned Threads = 0;
+        uint64_t Games = 0;
+        uint64_t Ticks = 0;
+        int64_t TotalScore = 0;
+        uint64_t Victories = 0;
+        std::vector<double> GamesPerSecond;
+        std::vector<double> TicksPerSecond;
+    };
+
+    double Median(std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        size_t mid = values.size() / 2;
+        return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+    }
+
+    std::string ToJson(const std::vector<Measurement>& measurements, const BatchRunConfig& config,
+                       unsigned repetitions) {
+        std::ostringstream out;
+        out << std::setprecision(10);
+        out << "{\n"
+            << "  \"benchmark\": \"PacmanThroughput\",\n"
+            << "  \"format\": " << FormatVersion << ",\n"
+            << "  \"games\": " << config.GameCount << ",\n"
+            << "  \"seed\": " << config.BaseSeed << ",\n"
+            << "  \"repetitions\": " << repetitions << ",\n"
+            << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+            << "  \"results\": [\n";
+        for (size_t i = 0; i < measurements.size(); ++i) {
+            const Measurement& m = measurements[i];
+            auto [minRate, maxRate] = std::minmax_element(m.GamesPerSecond.begin(), m.GamesPerSecond.end());
+            // One object per line, so the files diff well in version control
+            out << "    {\"name\": \"" << m.Agent << "/threads:" << m.Threads << "\""
+                << ", \"agent\": \"" << m.Agent << "\""
+                << ", \"threads\": " << m.Threads
+                << ", \"games\": " << m.Games
+                << ", \"ticks\": " << m.Ticks
+                << ", \"total_score\": " << m.TotalScore
+                << ", \"victories\": " << m.Victories
+                << ", \"games_per_second\": " << Median(m.GamesPerSecond)
+                << ", \"min_games_per_second\": " << *minRate
+                << ", \"max_games_per_second\": " << *maxRate
+                << ", \"ticks_per_second\": " << Median(m.TicksPerSecond)
+                << '}' << (i + 1 < measurements.size() ? "," : "") << '\n';
+        }
+        out << "  ]\n}\n";
+        return out.str();
+    }
+
+}
+
+int main(int argc, char** argv) {
+    BatchRunConfig config;
+    config.GameCount = 2000;
+    unsigned repetitions = 3;
+    std::vector<std::string_view> agents = {"random", "greedy"};
+    std::vector<unsigned> threadCounts;
+    std::string outPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool ok = true;
+        if (arg == "--help" || arg == "-h") {
+            PrintUsage();
+            return 0;
+        } else if (!value) {
+            ok = false;
+        } else if (arg == "--games") {
+            ok = ParseNumber(value, config.GameCount) && config.GameCount > 0;
+        } else if (arg == "--seed") {
+            ok = ParseNumber(value, config.BaseSeed);
+        } else if (arg == "--repetitions") {
+            ok = ParseNumber(value, repetitions) && repetitions > 0;
+        } else if (arg == "--agents") {
+            agents = Split(value);
+            for (std::string_view agent : agents) ok = ok && MakeAgentFactory(agent);
+        } else if (arg == "--threads") {
+            for (std::string_view count : Split(value)) {
+                ok = ok && ParseNumber(count, threadCounts.emplace_back()) && threadCounts.back() > 0;
+            }
+        } else if (arg == "--out") {
+            outPath = value;
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            std::cerr << "Invalid argument: " << arg << '\n';
+            PrintUsage();
+            return 1;
+        }
+        ++i;
+    }
+
+    if (threadCounts.empty()) {
+        unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+        threadCounts = {1, std::max(1u, hardware / 2), hardware};
+    }
+    std::sort(threadCounts.begin(), threadCounts.end());
+    threadCounts.erase(std::unique(threadCounts.begin(), threadCounts.end()), threadCounts.end());
+
+    std::vector<Measurement> measurements;
+    std::cout << std::fixed << std::setprecision(0);
+    for (std::string_view agent : agents) {
+        AgentFactory makeAgent = MakeAgentFactory(agent);
+        for (unsigned threads : threadCounts) {
+            Measurement& m = measurements.emplace_back();
+            m.Agent = agent;
+            m.Threads = threads;
+            config.ThreadCount = threads;
+            for (unsigned r = 0; r < repetitions; ++r) {
+                BatchReport report = RunBatch(config, makeAgent);
+                // Fixed seeds: every repetition plays the same games
+                m.Games = report.Games;
+                m.Ticks = report.Ticks;
+                m.TotalScore = report.TotalScore;
+                m.Victories = report.Victories;
+                m.GamesPerSecond.push_back(report.GamesPerSecond);
+                m.TicksPerSecond.push_back(report.TicksPerSecond);
+            }
+            std::cout << std::left << std::setw(8) << agent << std::right << std::setw(3) << threads
+                      << " threads: " << std::setw(9) << Median(m.GamesPerSecond) << " games/sec, "
+                      << std::setw(10) << Median(m.TicksPerSecond) << " ticks/sec\n";
+        }
+    }
+
+    if (!outPath.empty()) {
+        std::ofstream out(outPath);
+        out << ToJson(measurements, config, repetitions);
+        if (!out) {
+            std::cerr << "Error: Failed to write " << outPath << '\n';
+            return 1;
+        }
+    }
+    return 0;
+}
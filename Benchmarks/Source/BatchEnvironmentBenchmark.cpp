@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+#include "BatchEnvironment.hpp"
+#include "IGameEngine.hpp"
+
+#include <vector>
+
+using namespace Pacman;
+
+namespace {
+
+    constexpr Direction Actions[] = {
+        Direction::Up, Direction::Left, Direction::Down, Direction::Right
+    };
+
+    /// @brief Cheap deterministic action stream so input generation does not dominate
+    Direction NextAction(uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return Actions[state >> 30];
+    }
+
+}
+
+static void BM_GameEngineUpdate(benchmark::State& state) {
+    auto engine = CreateGameEngine();
+    engine->StartNewGame();
+    uint32_t inputs = 1;
+
+    for (auto _ : state) {
+        if (engine->GetState() != GameState::Running) {
+            engine->StartNewGame();
+        }
+        engine->SetPlayerDirection(NextAction(inputs));
+        engine->Update(BatchEnvironment::DefaultDeltaTime);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GameEngineUpdate);
+
+// An agent has to read the player and ghosts back every tick to choose its next action
+static void BM_GameEngineObservedTick(benchmark::State& state) {
+    auto engine = CreateGameEngine();
+    engine->StartNewGame();
+    uint32_t inputs = 1;
+
+    for (auto _ : state) {
+        if (engine->GetState() != GameState::Running) {
+            engine->StartNewGame();
+        }
+        engine->SetPlayerDirection(NextAction(inputs));
+        engine->Update(BatchEnvironment::DefaultDeltaTime);
+        benchmark::DoNotOptimize(engine->GetPlayerState());
+        benchmark::DoNotOptimize(engine->GetGhostStates());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GameEngineObservedTick);
+
+static void BM_BatchEnvironmentStep(benchmark::State& state) {
+    const auto gameCount = static_cast<std::size_t>(state.range(0));
+    BatchEnvironment batch(gameCount, 1);
+    std::vector<Direction> actions(gameCount);
+    uint32_t inputs = 1;
+
+    for (auto _ : state) {
+        for (std::size_t game = 0; game < gameCount; ++game) {
+            if (batch.GetState(game) != GameState::Running) {
+                batch.ResetGame(game);
+            }
+            actions[game] = NextAction(inputs);
+        }
+        batch.Step(actions);
+    }
+    // One item is one game advanced by one tick, comparable to BM_GameEngineUpdate
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(gameCount));
+}
+BENCHMARK(BM_BatchEnvironmentStep)->Arg(1)->Arg(64)->Arg(1024)->Arg(4096);
+
+// 1024 games per step with the ghost kernel forced to Scalar (0), SSE2 (1) or AVX2 (2)
+static void BM_BatchEnvironmentStepSimd(benchmark::State& state) {
+    constexpr std::size_t GameCount = 1024;
+    BatchEnvironment batch(GameCount, 1);
+    batch.SetSimdLevel(static_cast<SimdLevel>(state.range(0)));
+    std::vector<Direction> actions(GameCount);
+    uint32_t inputs = 1;
+
+    for (auto _ : state) {
+        for (std::size_t game = 0; game < GameCount; ++game) {
+            if (batch.GetState(game) != GameState::Running) {
+                batch.ResetGame(game);
+            }
+            actions[game] = NextAction(inputs);
+        }
+        batch.Step(actions);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(GameCount));
+    constexpr const char* Names[] = {"scalar", "sse2", "avx2"};
+    state.SetLabel(Names[static_cast<int>(batch.GetSimdLevel())]);
+}
+BENCHMARK(BM_BatchEnvironmentStepSimd)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_BatchEnvironmentObservedStep(benchmark::State& state) {
+    const auto gameCount = static_cast<std::size_t>(state.range(0));
+    BatchEnvironment batch(gameCount, 1);
+    std::vector<Direction> actions(gameCount);
+    uint32_t inputs = 1;
+
+    for (auto _ : state) {
+        for (std::size_t game = 0; game < gameCount; ++game) {
+            if (batch.GetState(game) != GameState::Running) {
+                batch.ResetGame(game);
+            }
+            actions[game] = NextAction(inputs);
+        }
+        batch.Step(actions);
+        for (std::size_t game = 0; game < gameCount; ++game) {
+            benchmark::DoNotOptimize(batch.GetPlayerPosition(game));
+            for (std::size_t ghost = 0; ghost < BatchEnvironment::GhostCount; ++ghost) {
+                benchmark::DoNotOptimize(batch.GetGhostPosition(game, ghost));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(gameCount));
+}
+BENCHMARK(BM_BatchEnvironmentObservedStep)->Arg(1024);
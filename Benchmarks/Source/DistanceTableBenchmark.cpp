@@ -0,0 +1,27 @@
+#include <benchmark/benchmark.h>
+#include "DistanceTable.hpp"
+
+using namespace Pacman;
+
+static void BM_DistanceTableBuild(benchmark::State& state) {
+    for (auto _ : state) {
+        DistanceTable table(DefaultLevelData, MazeGraph::Mover::Ghost);
+        benchmark::DoNotOptimize(table.GetNodeCount());
+    }
+}
+BENCHMARK(BM_DistanceTableBuild)->Unit(benchmark::kMillisecond);
+
+static void BM_DistanceTableQuery(benchmark::State& state) {
+    DistanceTable table(DefaultLevelData, MazeGraph::Mover::Ghost);
+    uint32_t tiles = 1;
+
+    for (auto _ : state) {
+        tiles = tiles * 1664525u + 1013904223u;
+        int from = static_cast<int>((tiles >> 8) % MazeGraph::TileCount);
+        int to = static_cast<int>((tiles >> 20) % MazeGraph::TileCount);
+        benchmark::DoNotOptimize(table.GetDistance(from, to));
+        benchmark::DoNotOptimize(table.GetNextHop(from, to));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DistanceTableQuery);
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+#include "IGameEngine.hpp"
+#include "IEventListener.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace Pacman;
+
+namespace {
+
+    constexpr float FrameTime = 1.0f / 60.0f;
+
+    constexpr Direction Actions[] = {
+        Direction::Up, Direction::Left, Direction::Down, Direction::Right
+    };
+
+    /// @brief Listener that only counts, so the cost measured is the dispatch itself
+    class CountingListener : public IEventListener {
+    public:
+        void OnTileUpdated(const TileUpdate&) override { ++Events; }
+        void OnPlayerStateChanged(const PlayerState&) override { ++Events; }
+        void OnGameStateChanged(GameState) override { ++Events; }
+        void OnGhostsUpdated(std::span<const GhostState>) override { ++Events; }
+
+        uint64_t Events = 0;
+    };
+
+    /// @brief Fixed-dt frames with a pseudo-random direction every few frames, restarting finished games
+    void RunFrames(benchmark::State& state, IGameEngine& engine) {
+        uint32_t inputs = 1;
+        uint32_t frame = 0;
+        for (auto _ : state) {
+            if (engine.GetState() != GameState::Running) {
+                engine.StartNewGame();
+            }
+            if (frame++ % 8 == 0) {
+                inputs = inputs * 1664525u + 1013904223u;
+                engine.SetPlayerDirection(Actions[inputs >> 30]);
+            }
+            engine.Update(FrameTime);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    enum class GhostPhase { None, Scatter, Chase, Frightened };
+
+    /// @brief Mid-game state whose next Update runs exactly one ghost step and no player step
+    EngineSnapshot MakeGhostStepSnapshot(IGameEngine& engine, GhostPhase phase) {
+        engine.StartNewGame();
+        engine.SetPlayerDirection(Direction::Left);
+        // Long enough for every ghost to have left the house
+        for (int tick = 0; tick < 600 && engine.GetState() == GameState::Running; ++tick) {
+            engine.Update(FrameTime);
+        }
+
+        EngineSnapshot snapshot;
+        engine.SaveSnapshot(snapshot);
+        GhostModeController::State mode{};
+        mode.IsScatterPhase = phase != GhostPhase::Chase;
+        mode.IsFrightened = phase == GhostPhase::Frightened;
+        mode.FrightenedTimer = mode.IsFrightened ? GameConfig::PowerUpDuration : 0.0f;
+        snapshot.ModeController.SetState(mode);
+        for (GhostState& ghost : snapshot.Ghosts) {
+            ghost.IsFrightened = mode.IsFrightened;
+            ghost.IsEaten = false;
+        }
+        float interval = mode.IsFrightened ? GameConfig::GhostFrightenedStepInterval : GameConfig::GhostStepInterval;
+        snapshot.State = GameState::Running;
+        snapshot.PlayerStepTimer = 0.0f;
+        snapshot.GhostStepTimer = phase == GhostPhase::None ? 0.0f : interval;
+        return snapshot;
+    }
+
+}
+
+// One UpdateGhosts call, i.e. targeting plus ChooseGhostDirection for four
+// ghosts, per iteration. Each iteration restores a snapshot first; the "none"
+// case restores and updates without a ghost step, so the step itself is the
+// difference to it.
+static void BM_GameEngineGhostStep(benchmark::State& state) {
+    auto phase = static_cast<GhostPhase>(state.range(0));
+    auto engine = CreateGameEngine(1);
+    EngineSnapshot snapshot = MakeGhostStepSnapshot(*engine, phase);
+
+    engine->RestoreSnapshot(snapshot);
+    engine->Update(0.0f);
+    if (engine->GetPlayerState().Lives != snapshot.Player.Lives) {
+        state.SkipWithError("ghost step collides with the player");
+        return;
+    }
+
+    for (auto _ : state) {
+        engine->RestoreSnapshot(snapshot);
+        engine->Update(0.0f);
+    }
+    state.SetItemsProcessed(state.iterations() * (phase == GhostPhase::None ? 0 : 4));
+    static constexpr const char* Labels[] = {"none", "scatter", "chase", "frightened"};
+    state.SetLabel(Labels[state.range(0)]);
+}
+BENCHMARK(BM_GameEngineGhostStep)->DenseRange(0, 3);
+
+// Frames at 60 Hz with 0, 1 and 8 listeners attached; 0 matches BM_GameEngineUpdate
+// and the slope is the per-listener dispatch cost
+static void BM_GameEngineUpdateListeners(benchmark::State& state) {
+    auto engine = CreateGameEngine(1);
+    std::vector<std::shared_ptr<CountingListener>> listeners;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        engine->AddListener(listeners.emplace_back(std::make_shared<CountingListener>()));
+    }
+    engine->StartNewGame();
+    RunFrames(state, *engine);
+
+    uint64_t events = 0;
+    for (const auto& listener : listeners) events += listener->Events;
+    state.counters["events"] = benchmark::Counter(static_cast<double>(events), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_GameEngineUpdateListeners)->Arg(0)->Arg(1)->Arg(8);
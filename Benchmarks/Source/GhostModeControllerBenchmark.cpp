@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+#include "GhostModeController.hpp"
+
+using namespace Pacman;
+
+// The whole level-1 timeline at 60 Hz: every scatter/chase wave until permanent
+// chase, with a power pellet eaten every 30 seconds. One item is one Update.
+static void BM_GhostModeControllerTimeline(benchmark::State& state) {
+    constexpr float FrameTime = 1.0f / 60.0f;
+    constexpr int Frames = 120 * 60;
+    GhostModeController controller;
+    int reversals = 0;
+
+    for (auto _ : state) {
+        controller.Reset();
+        for (int frame = 0; frame < Frames; ++frame) {
+            if (frame % (30 * 60) == 0) controller.TriggerFrightenedMode();
+            controller.Update(FrameTime);
+            reversals += controller.ShouldReverseDirection();
+            benchmark::DoNotOptimize(controller.GetCurrentMode());
+        }
+    }
+    benchmark::DoNotOptimize(reversals);
+    state.SetItemsProcessed(state.iterations() * Frames);
+}
+BENCHMARK(BM_GhostModeControllerTimeline);
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+#include "GhostStrategies.hpp"
+#include "IGameEngine.hpp"
+
+#include <array>
+#include <memory>
+
+using namespace Pacman;
+
+namespace {
+
+    constexpr Direction Actions[] = {
+        Direction::Up, Direction::Left, Direction::Down, Direction::Right
+    };
+
+    /// @brief Player wandering over the board so targets do not constant-fold
+    PlayerState NextPlayer(uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        PlayerState player{};
+        player.Position = {static_cast<int>((state >> 8) % 28), static_cast<int>((state >> 16) % 31)};
+        player.CurrentDirection = Actions[state >> 30];
+        return player;
+    }
+
+    std::array<PlayerState, 256> MakePlayers() {
+        std::array<PlayerState, 256> players{};
+        uint32_t inputs = 1;
+        for (auto& player : players) player = NextPlayer(inputs);
+        return players;
+    }
+
+    std::array<GhostState, 4> MakeGhosts() {
+        std::array<GhostState, 4> ghosts{};
+        for (size_t i = 0; i < ghosts.size(); ++i) {
+            ghosts[i].Position = {11 + static_cast<int>(i), 14};
+            ghosts[i].ScatterTarget = {0, 34};
+            ghosts[i].Type = static_cast<GhostType>(i);
+        }
+        return ghosts;
+    }
+
+}
+
+// One item is one ghost's chase target, i.e. the targeting part of a ghost step
+static void BM_ChaseTargetStatic(benchmark::State& state) {
+    std::array<GhostStrategy, 4> strategies;
+    for (size_t i = 0; i < strategies.size(); ++i) {
+        strategies[i] = MakeGhostStrategy(static_cast<GhostType>(i));
+    }
+    auto ghosts = MakeGhosts();
+    const auto players = MakePlayers();
+    uint8_t next = 0;
+
+    for (auto _ : state) {
+        const PlayerState& player = players[next++];
+        Vector2 red = ghosts[0].Position;
+        for (size_t i = 0; i < ghosts.size(); ++i) {
+            ghosts[i].TargetTile = CalculateChaseTarget(strategies[i], ghosts[i], player, red);
+        }
+        benchmark::DoNotOptimize(ghosts);
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_ChaseTargetStatic);
+
+static void BM_ChaseTargetVirtual(benchmark::State& state) {
+    std::array<std::unique_ptr<IGhost>, 4> ais;
+    for (size_t i = 0; i < ais.size(); ++i) {
+        ais[i] = CreateGhostAI(static_cast<GhostType>(i));
+    }
+    auto ghosts = MakeGhosts();
+    const auto players = MakePlayers();
+    uint8_t next = 0;
+
+    for (auto _ : state) {
+        const PlayerState& player = players[next++];
+        Vector2 red = ghosts[0].Position;
+        for (size_t i = 0; i < ghosts.size(); ++i) {
+            ghosts[i].TargetTile = ais[i]->CalculateChaseTarget(ghosts[i], player, red);
+        }
+        benchmark::DoNotOptimize(ghosts);
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_ChaseTargetVirtual);
+
+// Whole ticks with the built-in rules versus the same rules installed as custom IGhost AIs
+static void BM_GameEngineUpdateGhostDispatch(benchmark::State& state) {
+    auto engine = CreateGameEngine(1);
+    if (state.range(0)) {
+        for (int i = 0; i < 4; ++i) {
+            auto type = static_cast<GhostType>(i);
+            engine->SetGhostAI(type, CreateGhostAI(type));
+        }
+    }
+    engine->StartNewGame();
+    uint32_t inputs = 1;
+
+    for (auto _ : state) {
+        if (engine->GetState() != GameState::Running) {
+            engine->StartNewGame();
+        }
+        engine->SetPlayerDirection(NextPlayer(inputs).CurrentDirection);
+        engine->Update(1.0f / 60.0f);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(state.range(0) ? "virtual" : "static");
+}
+BENCHMARK(BM_GameEngineUpdateGhostDispatch)->Arg(0)->Arg(1);
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+#include "IGameEngine.hpp"
+#include "IEventListener.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Pacman;
+
+namespace {
+
+    /// @brief Listener that burns a fixed amount of time per ghost notification,
+    /// standing in for an expensive tick (recording, rendering, networking)
+    class SlowListener : public IEventListener {
+    public:
+        explicit SlowListener(std::chrono::microseconds cost) : cost_(cost) {}
+
+        void OnTileUpdated(const TileUpdate&) override {}
+        void OnPlayerStateChanged(const PlayerState&) override {}
+        void OnGameStateChanged(GameState) override {}
+
+        void OnGhostsUpdated(std::span<const GhostState>) override {
+            auto until = std::chrono::steady_clock::now() + cost_;
+            while (std::chrono::steady_clock::now() < until) {}
+        }
+
+    private:
+        std::chrono::microseconds cost_;
+    };
+
+}
+
+// Input submission latency while another thread ticks the engine continuously.
+// The argument is the extra cost of each tick in microseconds; submission time
+// should stay flat as it grows.
+static void BM_SetPlayerDirectionDuringTick(benchmark::State& state) {
+    auto engine = CreateGameEngine();
+    engine->AddListener(std::make_shared<SlowListener>(std::chrono::microseconds(state.range(0))));
+    engine->StartNewGame();
+
+    std::atomic<bool> running{true};
+    std::thread simulation([&] {
+        while (running) {
+            if (engine->GetState() == GameState::GameOver || engine->GetState() == GameState::Victory) {
+                engine->StartNewGame();
+            }
+            // Long enough that every tick steps the ghosts and pays the listener cost
+            engine->Update(0.2f);
+        }
+    });
+
+    const Direction directions[] = {Direction::Up, Direction::Left, Direction::Down, Direction::Right};
+    int next = 0;
+    for (auto _ : state) {
+        engine->SetPlayerDirection(directions[next++ & 3]);
+    }
+
+    running = false;
+    simulation.join();
+}
+BENCHMARK(BM_SetPlayerDirectionDuringTick)->Arg(0)->Arg(100)->Arg(1000)->UseRealTime();
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+#include "Map.hpp"
+
+using namespace Pacman;
+
+namespace {
+
+    /// @brief Built-in maze with every third pellet eaten, as in the middle of a game
+    Map MakePartlyEatenMap() {
+        Map map;
+        int next = 0;
+        for (const Vector2& pos : map.GetPelletPositions()) {
+            if (next++ % 3 == 0) map.SetTileAt(pos, TileType::Path);
+        }
+        return map;
+    }
+
+}
+
+static void BM_MapInitialize(benchmark::State& state) {
+    Map map = MakePartlyEatenMap();
+
+    for (auto _ : state) {
+        map.Initialize();
+        benchmark::DoNotOptimize(map);
+    }
+}
+BENCHMARK(BM_MapInitialize);
+
+// One item is one remaining pellet
+static void BM_MapGetPelletPositions(benchmark::State& state) {
+    Map map = MakePartlyEatenMap();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.GetPelletPositions());
+    }
+    state.SetItemsProcessed(state.iterations() * map.GetPelletCount());
+}
+BENCHMARK(BM_MapGetPelletPositions);
+
+// Every tile of the maze in row-major order, as a renderer would read them
+static void BM_MapGetTileAt(benchmark::State& state) {
+    Map map = MakePartlyEatenMap();
+
+    for (auto _ : state) {
+        for (int y = 0; y < Map::Height; ++y) {
+            for (int x = 0; x < Map::Width; ++x) {
+                benchmark::DoNotOptimize(map.GetTileAt({x, y}));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * Map::Width * Map::Height);
+}
+BENCHMARK(BM_MapGetTileAt);
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include "IGameEngine.hpp"
+
+using namespace Pacman;
+
+namespace {
+
+    /// @brief Engine a few seconds into a game, so the snapshot is not the initial state
+    std::shared_ptr<IGameEngine> CreatePlayedEngine() {
+        auto engine = CreateGameEngine();
+        engine->StartNewGame();
+        engine->SetPlayerDirection(Direction::Left);
+        for (int tick = 0; tick < 180; ++tick) {
+            engine->Update(1.0f / 60.0f);
+        }
+        return engine;
+    }
+
+}
+
+static void BM_SaveSnapshot(benchmark::State& state) {
+    auto engine = CreatePlayedEngine();
+    EngineSnapshot snapshot;
+
+    for (auto _ : state) {
+        engine->SaveSnapshot(snapshot);
+        benchmark::DoNotOptimize(snapshot);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(sizeof(EngineSnapshot)));
+}
+BENCHMARK(BM_SaveSnapshot);
+
+static void BM_RestoreSnapshot(benchmark::State& state) {
+    auto engine = CreatePlayedEngine();
+    EngineSnapshot snapshot;
+    engine->SaveSnapshot(snapshot);
+
+    for (auto _ : state) {
+        engine->RestoreSnapshot(snapshot);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(sizeof(EngineSnapshot)));
+}
+BENCHMARK(BM_RestoreSnapshot);
+
+// Clone has to allocate the new engine; branching searches should prefer snapshots
+static void BM_Clone(benchmark::State& state) {
+    auto engine = CreatePlayedEngine();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(engine->Clone());
+    }
+}
+BENCHMARK(BM_Clone);
+
+// Resetting copies the compile-time level image instead of parsing the maze
+static void BM_StartNewGame(benchmark::State& state) {
+    auto engine = CreatePlayedEngine();
+
+    for (auto _ : state) {
+        engine->StartNewGame();
+    }
+}
+BENCHMARK(BM_StartNewGame);
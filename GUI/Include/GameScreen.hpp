@@ -3,6 +3,7 @@
 #include <SFML/Graphics.hpp>
 #include "IEventListener.hpp"
 #include "IGameEngine.hpp"
+#include <string>
 #include <vector>
 #include <memory>
 #include <functional>
@@ -28,7 +29,10 @@ namespace Pacman {
         void OnTileUpdated(const TileUpdate& update) override;
         void OnPlayerStateChanged(const PlayerState& state) override;
         void OnGameStateChanged(GameState state) override;
-        void OnGhostsUpdated(const std::vector<GhostState>& ghosts) override;
+        void OnGhostsUpdated(std::span<const GhostState> ghosts) override;
+        void OnGhostModeChanged(GhostMode mode) override;
+        void OnInputLogged(const InputLogEntry& entry) override;
+        void OnLevelLoaded(uint32_t levelIndex) override;
 
         /// @brief Render the game
         /// @param window The window to render to
@@ -47,15 +51,36 @@ namespace Pacman {
         void RenderGhosts(sf::RenderWindow& window);
         void RenderHud(sf::RenderWindow& window);
 
+        /// @brief Give the persistent HUD texts their font, size, color and fixed strings
+        void SetUpHud();
+
+        /// @brief Set the overlay title for gameState_ and center it and the Play Again button
+        /// @param windowSize Size the overlay is laid out for; it is redone only when this or the state changes
+        void LayoutOverlay(sf::Vector2u windowSize);
+
+        /// @brief Rebuild the wall, ghost door and pellet geometry from the engine's tiles
+        /// Only runs when the engine, the assets or the game change; in between,
+        /// the pellet layer follows the queued tile updates.
+        void RebuildMapLayers();
+
+        /// @brief Apply the tile updates queued since the last frame to the pellet layer and clear the queue
+        void ApplyTileUpdates();
+
+        /// @brief Point the pellet quad of a tile at the right atlas cell, or collapse it when the pellet is gone
+        void SetPelletQuad(int x, int y, TileType tile);
+
         /// @brief Calculate wall sprite index based on adjacent tiles (0-15)
+        /// @param tiles Every tile of the map in row-major order, read once per rebuild
+        /// @param mapSize Map size in tiles
         /// @param x X coordinate in tile space
         /// @param y Y coordinate in tile space
         /// @return Sprite index using formula: down + 2*(left + 2*(right + 2*up))
-        int CalculateWallSpriteIndex(int x, int y) const;
+        static int CalculateWallSpriteIndex(const std::vector<TileType>& tiles, Vector2 mapSize, int x, int y);
 
         std::shared_ptr<IGameEngine> gameEngine_;
 
         // Cached state
+        // Tile updates since the last frame; consumed at the start of Render
         std::vector<TileUpdate> updatedTiles_;
         PlayerState playerState_{};
         std::vector<GhostState> ghostStates_;
@@ -68,20 +93,45 @@ namespace Pacman {
         sf::Texture mapTexture_;
         sf::Font hudFont_;
 
+        // Map geometry, one draw call per layer
+        sf::VertexArray wallLayer_{sf::Quads};
+        sf::VertexArray pelletLayer_{sf::Quads};
+        // First pellet layer vertex of every tile in row-major order, -1 for tiles without a pellet
+        std::vector<int> pelletVertexOfTile_;
+        Vector2 layerMapSize_{0, 0};
+        bool mapLayersDirty_ = true;
+
+        // Rebuilt every frame from ghostStates_, drawn in one call
+        sf::VertexArray ghostLayer_{sf::Quads};
+
         // Sprites
         sf::Sprite pacmanSprite_;
-        std::vector<sf::Sprite> ghostSprites_;
 
         // Animation state
         float animationTimer_ = 0.0f;
         int pacmanFrame_ = 0;
         int ghostFrame_ = 0;
+        float ghostAnimationTimer_ = 0.0f;
+        // Counted down from each power pellet so frightened ghosts can flash before they recover
+        float frightenedTimeLeft_ = 0.0f;
 
         // Asset availability flags
         bool hasMapTexture_ = false;
+        bool hasGhostTexture_ = false;
 
         static constexpr int TILE_SIZE = 16;
 
+        // Retained HUD: strings and layout only change with the values they show
+        sf::Text scoreText_;
+        sf::Text powerText_;
+        sf::Text overlayText_;
+        sf::Text playAgainText_;
+        sf::RectangleShape playAgainButton_;
+        bool hasHudFont_ = false;
+        bool scoreTextDirty_ = true;
+        bool overlayDirty_ = true;
+        sf::Vector2u overlayLayoutSize_{0, 0};
+
         std::function<void()> playCallback_;
         sf::FloatRect playAgainButtonRect_;
     };
@@ -10,6 +10,7 @@ namespace Pacman {
     public:
         explicit InputController(std::shared_ptr<IGameEngine> gameEngine);
 
+        /// @brief Forward key presses to the engine; never blocks on a running Update
         void ProcessEvent(const sf::Event& event);
 
     private:
@@ -65,10 +65,19 @@ private:
 
     /**
      * @brief Update layout based on window size
+     *
+     * Text bounds only change with the strings, the font and the selection
+     * outline, so the layout is recomputed when the window size differs from
+     * the last layout or ApplySelectionStyle resets it.
      * @param window The SFML render window
      */
     void UpdateLayout(sf::RenderWindow& window);
 
+    /**
+     * @brief Color and outline the PLAY/QUIT texts for the selected item
+     */
+    void ApplySelectionStyle();
+
     /**
      * @brief Draw a styled button
      * @param window Render window
@@ -101,6 +110,11 @@ private:
 
     sf::FloatRect playRect_{};
     sf::FloatRect quitRect_{};
+
+    // Window size of the current layout; {0, 0} forces the next UpdateLayout
+    sf::Vector2u layoutSize_{0, 0};
+    // Item the texts are currently styled for; -1 forces ApplySelectionStyle
+    int styledIndex_ = -1;
 };
 
 }
\ No newline at end of file
@@ -5,6 +5,47 @@
 
 namespace Pacman {
 
+    namespace {
+
+        constexpr float TileSizeF = static_cast<float>(GameConfig::TileSize);
+
+        const sf::Color FallbackPelletColor(255, 184, 174);
+
+        /// @brief Write a square quad at position, textured from the same-sized square at texCoords
+        /// The texture coordinates are ignored when the array is drawn without a texture,
+        /// so the fallback rendering uses the same geometry with a fill color.
+        void SetQuad(sf::Vertex* quad, sf::Vector2f position, float size, sf::Vector2f texCoords,
+                     sf::Color color = sf::Color::White) {
+            quad[0] = sf::Vertex(position, color, texCoords);
+            quad[1] = sf::Vertex({position.x + size, position.y}, color, {texCoords.x + size, texCoords.y});
+            quad[2] = sf::Vertex({position.x + size, position.y + size}, color,
+                                 {texCoords.x + size, texCoords.y + size});
+            quad[3] = sf::Vertex({position.x, position.y + size}, color, {texCoords.x, texCoords.y + size});
+        }
+
+        /// @brief Body color of a ghost that is neither frightened nor eaten
+        sf::Color GetGhostColor(GhostType type) {
+            switch(type) {
+                case GhostType::Red:    return sf::Color(255, 0, 0);     // Red (Blinky)
+                case GhostType::Pink:   return sf::Color(255, 184, 222); // Pink (Pinky)
+                case GhostType::Blue:   return sf::Color(0, 255, 255);   // Cyan (Inky)
+                case GhostType::Orange: return sf::Color(255, 165, 0);   // Orange (Clyde)
+                default:                return sf::Color::Red;
+            }
+        }
+
+        /// @brief Append one tile-sized quad at tile (x, y), textured from cell (column, row) of a 16px atlas
+        void AppendTileQuad(sf::VertexArray& vertices, int x, int y, int column, int row,
+                            sf::Color color = sf::Color::White) {
+            std::size_t first = vertices.getVertexCount();
+            vertices.resize(first + 4);
+            SetQuad(&vertices[first],
+                    {static_cast<float>(x) * TileSizeF, static_cast<float>(y) * TileSizeF}, TileSizeF,
+                    {static_cast<float>(column) * TileSizeF, static_cast<float>(row) * TileSizeF}, color);
+        }
+
+    }
+
     GameScreen::GameScreen() = default;
 
     bool GameScreen::LoadAssets(const std::string& assetPath) {
@@ -22,9 +63,11 @@ namespace Pacman {
         if(!ghostTexture_.loadFromFile(assetPath + "/Ghost16.png")) {
             std::cerr << "Failed to load Ghost texture from: " << assetPath << "/Ghost16.png\n";
             std::cerr << "Using fallback colored ghost rendering\n";
+            hasGhostTexture_ = false;
         } else {
             std::cout << "Ghost texture loaded successfully: "
                       << ghostTexture_.getSize().x << "x" << ghostTexture_.getSize().y << " pixels\n";
+            hasGhostTexture_ = true;
         }
 
         // Load Pac-Man death texture (optional, but not used)
@@ -48,15 +91,23 @@ namespace Pacman {
         if(!hudFont_.loadFromFile("C:/Windows/Fonts/arial.ttf") &&
            !hudFont_.loadFromFile("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf")) {
             std::cerr << "Warning: Failed to load HUD font\n";
+            hasHudFont_ = false;
+        } else {
+            hasHudFont_ = true;
+            SetUpHud();
         }
 
         pacmanSprite_.setTexture(pacmanTexture_);
 
+        // Texture availability decides between atlas and flat colored geometry
+        mapLayersDirty_ = true;
+
         return success;
     }
 
     void GameScreen::SetGameEngine(std::shared_ptr<IGameEngine> gameEngine) {
         gameEngine_ = std::move(gameEngine);
+        mapLayersDirty_ = true;
     }
 
     void GameScreen::OnTileUpdated(const TileUpdate& update) {
@@ -64,15 +115,41 @@ namespace Pacman {
     }
 
     void GameScreen::OnPlayerStateChanged(const PlayerState& state) {
+        // Most updates only move Pac-Man; the score text is rebuilt when its numbers change
+        if(state.Score != playerState_.Score || state.Lives != playerState_.Lives) {
+            scoreTextDirty_ = true;
+        }
         playerState_ = state;
     }
 
     void GameScreen::OnGameStateChanged(GameState state) {
+        if(state != gameState_) {
+            overlayDirty_ = true;
+        }
         gameState_ = state;
     }
 
-    void GameScreen::OnGhostsUpdated(const std::vector<GhostState>& ghosts) {
-        ghostStates_ = ghosts;
+    void GameScreen::OnGhostsUpdated(std::span<const GhostState> ghosts) {
+        ghostStates_.assign(ghosts.begin(), ghosts.end());
+    }
+
+    void GameScreen::OnGhostModeChanged(GhostMode mode) {
+        // Every power pellet restarts the frightened time; the scatter/chase
+        // timeline is paused while frightened, so any other mode means it ended
+        frightenedTimeLeft_ = mode == GhostMode::Frightened ? GameConfig::PowerUpDuration : 0.0f;
+    }
+
+    void GameScreen::OnLevelLoaded(uint32_t /*levelIndex*/) {
+        // Like GameStarted, this arrives under the engine's lock
+        mapLayersDirty_ = true;
+    }
+
+    void GameScreen::OnInputLogged(const InputLogEntry& entry) {
+        // A new game restores every pellet and may be on a different level. This
+        // runs under the engine's lock, so the tiles are only read back on the next Render.
+        if (entry.Type == InputLogType::GameStarted) {
+            mapLayersDirty_ = true;
+        }
     }
 
     void GameScreen::SetPlayCallback(std::function<void()> cb) {
@@ -100,46 +177,33 @@ namespace Pacman {
             pacmanFrame_ = (pacmanFrame_ + 1) % 6; // 6 frames total
         }
 
-        // Ghost animation
-        if(animationTimer_ > 0.15f) {
+        // Ghost animation, on its own timer: animationTimer_ never gets past 0.08
+        ghostAnimationTimer_ += 0.016f;
+        if(ghostAnimationTimer_ > 0.15f) {
+            ghostAnimationTimer_ = 0.0f;
             ghostFrame_ = (ghostFrame_ + 1) % GameConfig::GhostFrameCount;
         }
+
+        if(gameState_ == GameState::Running && frightenedTimeLeft_ > 0.0f) {
+            frightenedTimeLeft_ -= 0.016f;
+        }
     }
 
     // ═══════════════════════════════════════════════════════════════════════════
     // WALL SPRITE SELECTION ALGORITHM
     // ═══════════════════════════════════════════════════════════════════════════
-    int GameScreen::CalculateWallSpriteIndex(int x, int y) const {
-        if (!gameEngine_) return 0;
-
-        Vector2 mapSize = gameEngine_->GetMapSize();
+    int GameScreen::CalculateWallSpriteIndex(const std::vector<TileType>& tiles, Vector2 mapSize, int x, int y) {
+        auto isWall = [&](int tx, int ty) {
+            return tiles[static_cast<std::size_t>(ty * mapSize.X + tx)] == TileType::Wall;
+        };
 
         // Check adjacent tiles for walls
-        bool up = false, down = false, left = false, right = false;
+        bool up = y > 0 && isWall(x, y - 1);
+        bool down = y < mapSize.Y - 1 && isWall(x, y + 1);
 
-        // Up neighbor
-        if (y > 0) {
-            up = (gameEngine_->GetTileAt({x, y - 1}) == TileType::Wall);
-        }
-
-        // Down neighbor
-        if (y < mapSize.Y - 1) {
-            down = (gameEngine_->GetTileAt({x, y + 1}) == TileType::Wall);
-        }
-
-        // Left neighbor (tunnel entrance handling)
-        if (x > 0) {
-            left = (gameEngine_->GetTileAt({x - 1, y}) == TileType::Wall);
-        } else {
-            left = true; // Treat tunnel entrance as connected
-        }
-
-        // Right neighbor (tunnel entrance handling)
-        if (x < mapSize.X - 1) {
-            right = (gameEngine_->GetTileAt({x + 1, y}) == TileType::Wall);
-        } else {
-            right = true; // Treat tunnel entrance as connected
-        }
+        // Left/right neighbors; a tunnel entrance at the map edge counts as connected
+        bool left = x == 0 || isWall(x - 1, y);
+        bool right = x == mapSize.X - 1 || isWall(x + 1, y);
 
         // Calculate sprite index using bitwise formula
         // Formula: down + 2*(left + 2*(right + 2*up))
@@ -150,145 +214,131 @@ namespace Pacman {
     }
 
     // ═══════════════════════════════════════════════════════════════════════════
-    // MAP RENDERING - SPRITE-BASED OR FALLBACK
+    // MAP LAYERS - BUILT ONCE PER GAME, PELLETS UPDATED INCREMENTALLY
     // ═══════════════════════════════════════════════════════════════════════════
-    void GameScreen::RenderMap(sf::RenderWindow& window) {
+    void GameScreen::RebuildMapLayers() {
+        wallLayer_.clear();
+        pelletLayer_.clear();
+        pelletVertexOfTile_.clear();
+        // The rebuild reads the current tiles, which already include every queued update
+        updatedTiles_.clear();
+        mapLayersDirty_ = false;
+        layerMapSize_ = {0, 0};
         if(!gameEngine_) return;
 
-        Vector2 mapSize = gameEngine_->GetMapSize();
-
-        if (hasMapTexture_) {
-            // ═══════════════════════════════════════════════════════════
-            // 🎨 SPRITE-BASED RENDERING (Map16.png loaded)
-            // ═══════════════════════════════════════════════════════════
-            sf::Sprite tileSprite;
-            tileSprite.setTexture(mapTexture_);
-
-            for(int y = 0; y < mapSize.Y; ++y) {
-                for(int x = 0; x < mapSize.X; ++x) {
-                    TileType tile = gameEngine_->GetTileAt({x, y});
-
-                    // Set sprite position
-                    tileSprite.setPosition(
-                        static_cast<float>(x * TILE_SIZE),
-                        static_cast<float>(y * TILE_SIZE)
-                    );
-
-                    switch(tile) {
-                        case TileType::Wall: {
-                            // 🧱 AUTO-SELECT WALL SPRITE (0-15) based on neighbors
-                            int spriteIndex = CalculateWallSpriteIndex(x, y);
-                            tileSprite.setTextureRect(sf::IntRect(
-                                spriteIndex * TILE_SIZE,  // X: 0, 16, 32, ..., 240
-                                0,                         // Y: row 0 (wall row)
-                                TILE_SIZE,                 // Width: 16px
-                                TILE_SIZE                  // Height: 16px
-                            ));
-                            window.draw(tileSprite);
-                            break;
-                        }
+        layerMapSize_ = gameEngine_->GetMapSize();
+        const std::size_t tileCount = static_cast<std::size_t>(layerMapSize_.X * layerMapSize_.Y);
+        pelletVertexOfTile_.assign(tileCount, -1);
 
-                        case TileType::Pellet: {
-                            // 🔴 PELLET: row 1, column 0
-                            tileSprite.setTextureRect(sf::IntRect(
-                                0,         // X: column 0
-                                TILE_SIZE, // Y: row 1
-                                TILE_SIZE,
-                                TILE_SIZE
-                            ));
-                            window.draw(tileSprite);
-                            break;
-                        }
+        // One engine query per tile; wall autotiling then only looks at this copy
+        std::vector<TileType> tiles;
+        tiles.reserve(tileCount);
+        for(int y = 0; y < layerMapSize_.Y; ++y) {
+            for(int x = 0; x < layerMapSize_.X; ++x) {
+                tiles.push_back(gameEngine_->GetTileAt({x, y}));
+            }
+        }
 
-                        case TileType::PowerPellet: {
-                            // ⚡ POWER PELLET: row 1, column 1
-                            tileSprite.setTextureRect(sf::IntRect(
-                                TILE_SIZE, // X: column 1
-                                TILE_SIZE, // Y: row 1
-                                TILE_SIZE,
-                                TILE_SIZE
-                            ));
-                            window.draw(tileSprite);
-                            break;
+        for(int y = 0; y < layerMapSize_.Y; ++y) {
+            for(int x = 0; x < layerMapSize_.X; ++x) {
+                TileType tile = tiles[static_cast<std::size_t>(y * layerMapSize_.X + x)];
+
+                switch(tile) {
+                    case TileType::Wall:
+                        if(hasMapTexture_) {
+                            // 🧱 AUTO-SELECT WALL SPRITE (0-15) based on neighbors, row 0
+                            AppendTileQuad(wallLayer_, x, y,
+                                           CalculateWallSpriteIndex(tiles, layerMapSize_, x, y), 0);
+                        } else {
+                            AppendTileQuad(wallLayer_, x, y, 0, 0, sf::Color(33, 33, 222));
                         }
+                        break;
 
-                        case TileType::GhostDoor: {
+                    case TileType::GhostDoor:
+                        if(hasMapTexture_) {
                             // 🚪 GHOST DOOR: row 1, column 2
-                            tileSprite.setTextureRect(sf::IntRect(
-                                2 * TILE_SIZE, // X: column 2
-                                TILE_SIZE,     // Y: row 1
-                                TILE_SIZE,
-                                TILE_SIZE
-                            ));
-                            window.draw(tileSprite);
-                            break;
+                            AppendTileQuad(wallLayer_, x, y, 2, 1);
+                        } else {
+                            AppendTileQuad(wallLayer_, x, y, 0, 0, sf::Color(255, 184, 222));
                         }
-
-                        default:
-                            // Empty/Path tiles - no rendering (black background)
-                            break;
+                        break;
+
+                    case TileType::Pellet:
+                    case TileType::PowerPellet: {
+                        std::size_t first = pelletLayer_.getVertexCount();
+                        pelletVertexOfTile_[y * layerMapSize_.X + x] = static_cast<int>(first);
+                        pelletLayer_.resize(first + 4);
+                        SetPelletQuad(x, y, tile);
+                        break;
                     }
+
+                    default:
+                        // Empty/Path tiles - no geometry (black background)
+                        break;
                 }
             }
+        }
+    }
+
+    void GameScreen::SetPelletQuad(int x, int y, TileType tile) {
+        sf::Vertex* quad = &pelletLayer_[static_cast<std::size_t>(pelletVertexOfTile_[y * layerMapSize_.X + x])];
+        sf::Vector2f corner(static_cast<float>(x) * TileSizeF, static_cast<float>(y) * TileSizeF);
+
+        if(tile != TileType::Pellet && tile != TileType::PowerPellet) {
+            // Eaten: collapse the quad so it rasterizes nothing
+            for(int i = 0; i < 4; ++i) quad[i].position = corner;
+            return;
+        }
+
+        if(hasMapTexture_) {
+            // 🔴 PELLET: row 1, column 0 / ⚡ POWER PELLET: row 1, column 1
+            float column = tile == TileType::Pellet ? 0.0f : 1.0f;
+            SetQuad(quad, corner, TileSizeF, {column * TileSizeF, TileSizeF});
         } else {
-            // ═══════════════════════════════════════════════════════════
-            // 🎨 FALLBACK: COLORED RECTANGLE RENDERING
-            // ═══════════════════════════════════════════════════════════
-            sf::RectangleShape tileShape({
-                static_cast<float>(TILE_SIZE),
-                static_cast<float>(TILE_SIZE)
-            });
-            sf::CircleShape pelletShape;
-
-            for(int y = 0; y < mapSize.Y; ++y) {
-                for(int x = 0; x < mapSize.X; ++x) {
-                    TileType tile = gameEngine_->GetTileAt({x, y});
-
-                    // Draw tile background
-                    if(tile == TileType::Wall) {
-                        tileShape.setFillColor(sf::Color(33, 33, 222));
-                    } else {
-                        tileShape.setFillColor(sf::Color::Black);
-                    }
+            // Fallback: a small square for pellets, a larger one for power pellets
+            float size = tile == TileType::Pellet ? 4.0f : 10.0f;
+            float inset = (TileSizeF - size) / 2.0f;
+            SetQuad(quad, {corner.x + inset, corner.y + inset}, size, {0.0f, 0.0f}, FallbackPelletColor);
+        }
+    }
 
-                    tileShape.setPosition(
-                        static_cast<float>(x * TILE_SIZE),
-                        static_cast<float>(y * TILE_SIZE)
-                    );
-                    window.draw(tileShape);
-
-                    // Draw pellets
-                    if(tile == TileType::Pellet) {
-                        pelletShape.setRadius(2.0f);
-                        pelletShape.setFillColor(sf::Color(255, 184, 174));
-                        pelletShape.setOrigin(2.0f, 2.0f);
-                        pelletShape.setPosition(
-                            static_cast<float>(x * TILE_SIZE) + TILE_SIZE / 2.0f,
-                            static_cast<float>(y * TILE_SIZE) + TILE_SIZE / 2.0f
-                        );
-                        window.draw(pelletShape);
-                    }
-                    else if(tile == TileType::PowerPellet) {
-                        pelletShape.setRadius(5.0f);
-                        pelletShape.setFillColor(sf::Color(255, 184, 174));
-                        pelletShape.setOrigin(5.0f, 5.0f);
-                        pelletShape.setPosition(
-                            static_cast<float>(x * TILE_SIZE) + TILE_SIZE / 2.0f,
-                            static_cast<float>(y * TILE_SIZE) + TILE_SIZE / 2.0f
-                        );
-                        window.draw(pelletShape);
-                    }
-                    else if(tile == TileType::GhostDoor) {
-                        tileShape.setFillColor(sf::Color(255, 184, 222));
-                        tileShape.setPosition(
-                            static_cast<float>(x * TILE_SIZE),
-                            static_cast<float>(y * TILE_SIZE)
-                        );
-                        window.draw(tileShape);
-                    }
-                }
+    void GameScreen::ApplyTileUpdates() {
+        if(mapLayersDirty_) {
+            RebuildMapLayers();
+            return;
+        }
+
+        for(const TileUpdate& update : updatedTiles_) {
+            const Vector2& pos = update.Position;
+            if(pos.X < 0 || pos.Y < 0 || pos.X >= layerMapSize_.X || pos.Y >= layerMapSize_.Y) continue;
+
+            if(pelletVertexOfTile_[pos.Y * layerMapSize_.X + pos.X] >= 0) {
+                SetPelletQuad(pos.X, pos.Y, update.Type);
+            } else if(update.Type == TileType::Pellet || update.Type == TileType::PowerPellet) {
+                // A pellet where the level had none; the engine never does this, but stay correct
+                mapLayersDirty_ = true;
             }
         }
+        updatedTiles_.clear();
+
+        if(mapLayersDirty_) {
+            RebuildMapLayers();
+        }
+    }
+
+    // ═══════════════════════════════════════════════════════════════════════════
+    // MAP RENDERING - SPRITE-BASED OR FALLBACK
+    // ═══════════════════════════════════════════════════════════════════════════
+    void GameScreen::RenderMap(sf::RenderWindow& window) {
+        if(!gameEngine_) return;
+
+        // Same geometry either way; only the tileset decides whether it is textured
+        sf::RenderStates states;
+        if(hasMapTexture_) {
+            states.texture = &mapTexture_;
+        }
+        window.draw(wallLayer_, states);
+        window.draw(pelletLayer_, states);
     }
 
     void GameScreen::RenderPlayer(sf::RenderWindow& window) {
@@ -325,201 +375,172 @@ namespace Pacman {
         window.draw(pacmanSprite_);
     }
 
+    // ═══════════════════════════════════════════════════════════════════════════
+    // GHOST RENDERING - ONE BATCH FROM Ghost16.png
+    // ═══════════════════════════════════════════════════════════════════════════
+    // Row 0: white body frames, tinted per ghost
+    // Row 1: eyes looking right, up, left, down (columns 0-3); frightened face (column 4)
     void GameScreen::RenderGhosts(sf::RenderWindow& window) {
-        ghostSprites_.clear();
+        ghostLayer_.clear();
+
+        const bool warning = frightenedTimeLeft_ > 0.0f && frightenedTimeLeft_ <= GameConfig::PowerUpWarningTime;
+        // Alternate every 0.2s between blue and white during the warning
+        const bool flash = warning && static_cast<int>(frightenedTimeLeft_ / 0.2f) % 2 == 0;
 
-        // Use colored shapes rendering (fallback)
         for(const auto& ghost : ghostStates_) {
-            float posX = static_cast<float>(ghost.Position.X * TILE_SIZE);
-            float posY = static_cast<float>(ghost.Position.Y * TILE_SIZE);
+            const int x = ghost.Position.X;
+            const int y = ghost.Position.Y;
+
+            int eyeColumn = 0;
+            switch(ghost.CurrentDirection) {
+                case Direction::Up:    eyeColumn = 1; break;
+                case Direction::Left:  eyeColumn = 2; break;
+                case Direction::Down:  eyeColumn = 3; break;
+                default:               eyeColumn = 0; break;
+            }
+
+            if(!hasGhostTexture_) {
+                // Fallback: flat squares in the ghost's color, a small white one for eyes
+                sf::Color color = ghost.IsEaten ? sf::Color::White
+                                : ghost.IsFrightened ? (flash ? sf::Color::White : sf::Color(0, 0, 200))
+                                : GetGhostColor(ghost.Type);
+                float size = ghost.IsEaten ? 6.0f : TileSizeF;
+                float inset = (TileSizeF - size) / 2.0f;
+                std::size_t first = ghostLayer_.getVertexCount();
+                ghostLayer_.resize(first + 4);
+                SetQuad(&ghostLayer_[first],
+                        {static_cast<float>(x) * TileSizeF + inset, static_cast<float>(y) * TileSizeF + inset},
+                        size, {0.0f, 0.0f}, color);
+                continue;
+            }
 
             if(ghost.IsEaten) {
                 // Draw only eyes when eaten
-                sf::CircleShape eyeWhite(3.5f);
-                eyeWhite.setFillColor(sf::Color::White);
-
-                sf::CircleShape pupil(1.5f);
-                pupil.setFillColor(sf::Color::Blue);
-
-                // Left eye
-                eyeWhite.setPosition(posX + 3, posY + 5);
-                window.draw(eyeWhite);
-                pupil.setPosition(posX + 5, posY + 6);
-                window.draw(pupil);
-
-                // Right eye
-                eyeWhite.setPosition(posX + 10, posY + 5);
-                window.draw(eyeWhite);
-                pupil.setPosition(posX + 12, posY + 6);
-                window.draw(pupil);
+                AppendTileQuad(ghostLayer_, x, y, eyeColumn, 1);
+            } else if(ghost.IsFrightened) {
+                AppendTileQuad(ghostLayer_, x, y, ghostFrame_, 0, flash ? sf::Color::White : sf::Color(0, 0, 200));
+                AppendTileQuad(ghostLayer_, x, y, 4, 1, flash ? sf::Color::Red : sf::Color(255, 184, 174));
             } else {
-                // Draw ghost body
-                sf::Color ghostColor;
-                if(ghost.IsFrightened) {
-                    ghostColor = sf::Color(0, 0, 200); // Dark blue when frightened
-                } else {
-                    switch(ghost.Type) {
-                        case GhostType::Red:    ghostColor = sf::Color(255, 0, 0); break;     // Red (Blinky)
-                        case GhostType::Pink:   ghostColor = sf::Color(255, 184, 222); break; // Pink (Pinky)
-                        case GhostType::Blue:   ghostColor = sf::Color(0, 255, 255); break;   // Cyan (Inky)
-                        case GhostType::Orange: ghostColor = sf::Color(255, 165, 0); break;   // Orange (Clyde)
-                        default: ghostColor = sf::Color::Red; break;
-                    }
-                }
-
-                // Draw body as rounded rectangle
-                sf::CircleShape head(8.0f);
-                head.setFillColor(ghostColor);
-                head.setPosition(posX, posY);
-                window.draw(head);
-
-                sf::RectangleShape body(sf::Vector2f(16.0f, 10.0f));
-                body.setFillColor(ghostColor);
-                body.setPosition(posX, posY + 6);
-                window.draw(body);
-
-                // Draw eyes
-                sf::CircleShape eyeWhite(3.0f);
-                eyeWhite.setFillColor(sf::Color::White);
-
-                sf::CircleShape pupil(1.5f);
-                pupil.setFillColor(sf::Color::Black);
-
-                // Left eye
-                eyeWhite.setPosition(posX + 3, posY + 4);
-                window.draw(eyeWhite);
-                pupil.setPosition(posX + 4.5f, posY + 5.5f);
-                window.draw(pupil);
-
-                // Right eye
-                eyeWhite.setPosition(posX + 10, posY + 4);
-                window.draw(eyeWhite);
-                pupil.setPosition(posX + 11.5f, posY + 5.5f);
-                window.draw(pupil);
+                AppendTileQuad(ghostLayer_, x, y, ghostFrame_, 0, GetGhostColor(ghost.Type));
+                AppendTileQuad(ghostLayer_, x, y, eyeColumn, 1);
             }
         }
+
+        sf::RenderStates states;
+        if(hasGhostTexture_) {
+            states.texture = &ghostTexture_;
+        }
+        window.draw(ghostLayer_, states);
+    }
+
+    // ═══════════════════════════════════════════════════════════════════════════
+    // HUD - RETAINED TEXT, REBUILT ONLY ON CHANGE
+    // ═══════════════════════════════════════════════════════════════════════════
+    void GameScreen::SetUpHud() {
+        scoreText_.setFont(hudFont_);
+        scoreText_.setCharacterSize(20);
+        scoreText_.setFillColor(sf::Color::White);
+        scoreText_.setPosition(10.0f, 5.0f);
+        scoreTextDirty_ = true;
+
+        powerText_.setFont(hudFont_);
+        powerText_.setCharacterSize(18);
+        powerText_.setFillColor(sf::Color::Cyan);
+        powerText_.setString("POWER UP!");
+        powerText_.setPosition(10.0f, 35.0f);
+
+        overlayText_.setFont(hudFont_);
+        overlayDirty_ = true;
+
+        playAgainText_.setFont(hudFont_);
+        playAgainText_.setCharacterSize(24);
+        playAgainText_.setFillColor(sf::Color::White);
+        playAgainText_.setString("Play Again");
+        sf::FloatRect ptBounds = playAgainText_.getLocalBounds();
+        playAgainText_.setOrigin(ptBounds.width / 2.0f, ptBounds.height / 2.0f);
+
+        playAgainButton_.setFillColor(sf::Color(60, 60, 60));
+        playAgainButton_.setOutlineColor(sf::Color::White);
+        playAgainButton_.setOutlineThickness(2.0f);
+    }
+
+    void GameScreen::LayoutOverlay(sf::Vector2u windowSize) {
+        overlayLayoutSize_ = windowSize;
+        overlayDirty_ = false;
+
+        float centerX = static_cast<float>(windowSize.x) / 2.0f;
+        float centerY = static_cast<float>(windowSize.y) / 2.0f;
+
+        if(gameState_ == GameState::Paused) {
+            overlayText_.setCharacterSize(32);
+            overlayText_.setFillColor(sf::Color::Yellow);
+            overlayText_.setString("PAUSED");
+        } else if(gameState_ == GameState::GameOver) {
+            overlayText_.setCharacterSize(48);
+            overlayText_.setFillColor(sf::Color::Red);
+            overlayText_.setString("GAME OVER");
+        } else if(gameState_ == GameState::Victory) {
+            overlayText_.setCharacterSize(48);
+            overlayText_.setFillColor(sf::Color::Green);
+            overlayText_.setString("YOU WIN!");
+        } else {
+            return;
+        }
+
+        sf::FloatRect bounds = overlayText_.getLocalBounds();
+        overlayText_.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
+        if(gameState_ == GameState::Paused) {
+            overlayText_.setPosition(centerX, centerY);
+            return;
+        }
+        overlayText_.setPosition(centerX, centerY - 40.0f);
+
+        const float btnW = 200.0f;
+        const float btnH = 48.0f;
+        sf::Vector2f btnPos(centerX - btnW / 2.0f, centerY + 10.0f);
+
+        playAgainButton_.setSize(sf::Vector2f(btnW, btnH));
+        playAgainButton_.setPosition(btnPos);
+        playAgainText_.setPosition(btnPos.x + btnW / 2.0f, btnPos.y + btnH / 2.0f - 4.0f);
+        playAgainButtonRect_ = sf::FloatRect(btnPos.x, btnPos.y, btnW, btnH);
     }
 
     void GameScreen::RenderHud(sf::RenderWindow& window) {
         // Skip if font didn't load
-        if(!hudFont_.getInfo().family.empty()) {
-            sf::Text scoreText;
-            scoreText.setFont(hudFont_);
-            scoreText.setCharacterSize(20);
-            scoreText.setFillColor(sf::Color::White);
-            scoreText.setString(
+        if(!hasHudFont_) return;
+
+        if(scoreTextDirty_) {
+            scoreText_.setString(
                 "Score: " + std::to_string(playerState_.Score) +
                 "  Lives: " + std::to_string(playerState_.Lives)
             );
-            scoreText.setPosition(10.0f, 5.0f);
-            window.draw(scoreText);
-
-            // Game state overlays
-            if(gameState_ == GameState::Paused) {
-                sf::Text pauseText;
-                pauseText.setFont(hudFont_);
-                pauseText.setCharacterSize(32);
-                pauseText.setFillColor(sf::Color::Yellow);
-                pauseText.setString("PAUSED");
-
-                sf::FloatRect bounds = pauseText.getLocalBounds();
-                pauseText.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
-                pauseText.setPosition(
-                    static_cast<float>(window.getSize().x) / 2.0f,
-                    static_cast<float>(window.getSize().y) / 2.0f
-                );
-                window.draw(pauseText);
-            }
-            else if(gameState_ == GameState::GameOver) {
-                sf::Text gameOverText;
-                gameOverText.setFont(hudFont_);
-                gameOverText.setCharacterSize(48);
-                gameOverText.setFillColor(sf::Color::Red);
-                gameOverText.setString("GAME OVER");
-
-                sf::FloatRect bounds = gameOverText.getLocalBounds();
-                gameOverText.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
-                float centerX = static_cast<float>(window.getSize().x) / 2.0f;
-                float centerY = static_cast<float>(window.getSize().y) / 2.0f;
-                gameOverText.setPosition(centerX, centerY - 40.0f);
-                window.draw(gameOverText);
-
-                const float btnW = 200.0f;
-                const float btnH = 48.0f;
-                sf::Vector2f btnPos(centerX - btnW / 2.0f, centerY + 10.0f);
-
-                sf::RectangleShape btnShape(sf::Vector2f(btnW, btnH));
-                btnShape.setFillColor(sf::Color(60, 60, 60));
-                btnShape.setOutlineColor(sf::Color::White);
-                btnShape.setOutlineThickness(2.0f);
-                btnShape.setPosition(btnPos);
-                window.draw(btnShape);
-
-                sf::Text playText;
-                playText.setFont(hudFont_);
-                playText.setCharacterSize(24);
-                playText.setFillColor(sf::Color::White);
-                playText.setString("Play Again");
-                sf::FloatRect ptBounds = playText.getLocalBounds();
-                playText.setOrigin(ptBounds.width / 2.0f, ptBounds.height / 2.0f);
-                playText.setPosition(btnPos.x + btnW / 2.0f, btnPos.y + btnH / 2.0f - 4.0f);
-                window.draw(playText);
-
-                playAgainButtonRect_ = sf::FloatRect(btnPos.x, btnPos.y, btnW, btnH);
-            }
-            else if(gameState_ == GameState::Victory) {
-                sf::Text victoryText;
-                victoryText.setFont(hudFont_);
-                victoryText.setCharacterSize(48);
-                victoryText.setFillColor(sf::Color::Green);
-                victoryText.setString("YOU WIN!");
-
-                sf::FloatRect bounds = victoryText.getLocalBounds();
-                victoryText.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
-                float centerX = static_cast<float>(window.getSize().x) / 2.0f;
-                float centerY = static_cast<float>(window.getSize().y) / 2.0f;
-                victoryText.setPosition(centerX, centerY - 40.0f);
-                window.draw(victoryText);
-
-                const float btnW = 200.0f;
-                const float btnH = 48.0f;
-                sf::Vector2f btnPos(centerX - btnW / 2.0f, centerY + 10.0f);
-
-                sf::RectangleShape btnShape(sf::Vector2f(btnW, btnH));
-                btnShape.setFillColor(sf::Color(60, 60, 60));
-                btnShape.setOutlineColor(sf::Color::White);
-                btnShape.setOutlineThickness(2.0f);
-                btnShape.setPosition(btnPos);
-                window.draw(btnShape);
-
-                sf::Text playText;
-                playText.setFont(hudFont_);
-                playText.setCharacterSize(24);
-                playText.setFillColor(sf::Color::White);
-                playText.setString("Play Again");
-                sf::FloatRect ptBounds = playText.getLocalBounds();
-                playText.setOrigin(ptBounds.width / 2.0f, ptBounds.height / 2.0f);
-                playText.setPosition(btnPos.x + btnW / 2.0f, btnPos.y + btnH / 2.0f - 4.0f);
-                window.draw(playText);
-
-                playAgainButtonRect_ = sf::FloatRect(btnPos.x, btnPos.y, btnW, btnH);
+            scoreTextDirty_ = false;
+        }
+        window.draw(scoreText_);
+
+        // Game state overlays
+        if(gameState_ == GameState::Paused || gameState_ == GameState::GameOver ||
+           gameState_ == GameState::Victory) {
+            if(overlayDirty_ || window.getSize() != overlayLayoutSize_) {
+                LayoutOverlay(window.getSize());
             }
+            window.draw(overlayText_);
 
-            // Power-up indicator
-            if(playerState_.IsPoweredUp) {
-                sf::Text powerText;
-                powerText.setFont(hudFont_);
-                powerText.setCharacterSize(18);
-                powerText.setFillColor(sf::Color::Cyan);
-                powerText.setString("POWER UP!");
-                powerText.setPosition(10.0f, 35.0f);
-                window.draw(powerText);
+            if(gameState_ != GameState::Paused) {
+                window.draw(playAgainButton_);
+                window.draw(playAgainText_);
             }
         }
+
+        // Power-up indicator
+        if(playerState_.IsPoweredUp) {
+            window.draw(powerText_);
+        }
     }
 
     void GameScreen::Render(sf::RenderWindow& window) {
         UpdateAnimations();
+        ApplyTileUpdates();
 
         window.clear(sf::Color::Black);
 
@@ -45,7 +45,8 @@ namespace Pacman {
                 // pause
                 case sf::Keyboard::P:
                 case sf::Keyboard::Space:
-                    gameEngine_->SetPaused(gameEngine_->GetState() != GameState::Paused);
+                    // Toggled by the engine, since GetState lags behind presses not yet applied
+                    gameEngine_->TogglePaused();
                     break;
                     
                 default:
@@ -53,6 +53,10 @@ namespace Pacman {
         quitText_.setCharacterSize(48);
         quitText_.setFillColor(sf::Color::White);
 
+        // New glyphs, new bounds
+        layoutSize_ = {0, 0};
+        styledIndex_ = -1;
+
         return true;
     }
 
@@ -65,18 +69,23 @@ namespace Pacman {
     }
 
     void MenuScreen::UpdateLayout(sf::RenderWindow& window) {
-        const float width = static_cast<float>(window.getSize().x);
-        const float height = static_cast<float>(window.getSize().y);
+        // title pulse is the only per-frame change
+        float pulseScale = 1.0f + 0.05f * std::sin(animationTimer_ * 3.0f);
+        titleText_.setScale(pulseScale, pulseScale);
+
+        if(window.getSize() == layoutSize_) return;
+        layoutSize_ = window.getSize();
+
+        const float width = static_cast<float>(layoutSize_.x);
+        const float height = static_cast<float>(layoutSize_.y);
 
         // title
-        float pulseScale = 1.0f + 0.05f * std::sin(animationTimer_ * 3.0f);
         sf::FloatRect titleBounds = titleText_.getLocalBounds();
         titleText_.setOrigin(
             titleBounds.left + titleBounds.width / 2.0f,
             titleBounds.top + titleBounds.height / 2.0f
         );
         titleText_.setPosition(width * 0.5f, height * 0.18f);
-        titleText_.setScale(pulseScale, pulseScale);
 
         // play
         sf::FloatRect playBounds = playText_.getLocalBounds();
@@ -110,6 +119,32 @@ namespace Pacman {
         );
     }
 
+    void MenuScreen::ApplySelectionStyle() {
+        styledIndex_ = selectedIndex_;
+        // The outline grows the selected text's bounds, and with them its button
+        layoutSize_ = {0, 0};
+
+        bool playSelected = (selectedIndex_ == 0);
+        bool quitSelected = (selectedIndex_ == 1);
+
+        playText_.setFillColor(playSelected ? sf::Color::Cyan : sf::Color::White);
+        quitText_.setFillColor(quitSelected ? sf::Color::Cyan : sf::Color::White);
+
+        if(playSelected) {
+            playText_.setOutlineColor(sf::Color(0, 255, 255, 100));
+            playText_.setOutlineThickness(2.0f);
+        } else {
+            playText_.setOutlineThickness(0.0f);
+        }
+
+        if(quitSelected) {
+            quitText_.setOutlineColor(sf::Color(0, 255, 255, 100));
+            quitText_.setOutlineThickness(2.0f);
+        } else {
+            quitText_.setOutlineThickness(0.0f);
+        }
+    }
+
     void MenuScreen::HandleEvent(const sf::Event& event) {
         if(event.type == sf::Event::KeyPressed) {
             if(event.key.code == sf::Keyboard::Up || event.key.code == sf::Keyboard::W) {
@@ -181,28 +216,15 @@ namespace Pacman {
 
         DrawBackgroundPellets(window);
 
+        if(selectedIndex_ != styledIndex_) {
+            ApplySelectionStyle();
+        }
+
         UpdateLayout(window);
 
         bool playSelected = (selectedIndex_ == 0);
         bool quitSelected = (selectedIndex_ == 1);
 
-        playText_.setFillColor(playSelected ? sf::Color::Cyan : sf::Color::White);
-        quitText_.setFillColor(quitSelected ? sf::Color::Cyan : sf::Color::White);
-
-        if(playSelected) {
-            playText_.setOutlineColor(sf::Color(0, 255, 255, 100));
-            playText_.setOutlineThickness(2.0f);
-        } else {
-            playText_.setOutlineThickness(0.0f);
-        }
-
-        if(quitSelected) {
-            quitText_.setOutlineColor(sf::Color(0, 255, 255, 100));
-            quitText_.setOutlineThickness(2.0f);
-        } else {
-            quitText_.setOutlineThickness(0.0f);
-        }
-
         DrawButton(window, playRect_, playSelected);
         DrawButton(window, quitRect_, quitSelected);
 
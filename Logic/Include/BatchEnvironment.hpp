@@ -0,0 +1,192 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include "Bitboard.hpp"
+#include "GameConfig.hpp"
+#include "GhostKernel.hpp"
+#include "MazeGraph.hpp"
+#include "Random.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Pacman {
+
+    /// @brief Headless simulation of many games advanced together
+    ///
+    /// Game state is kept in structure-of-arrays form (one array per field,
+    /// indexed by game, or by game * 4 + ghost for ghosts) and has no locks,
+    /// listeners or virtual calls. One Step() is equivalent to calling
+    /// SetPlayerDirection(actions[i]) followed by Update(deltaTime) on every
+    /// running GameEngine, and produces the same outcomes.
+    ///
+    /// Timers of all games advance in one branch-free pass; only games with a
+    /// step or a mode change due are visited again. Ghost targeting and
+    /// direction choice for all games stepping ghosts in a tick run through
+    /// RunGhostKernel, 8 or 16 games per instruction.
+    class BatchEnvironment {
+    public:
+        static constexpr int GhostCount = 4;
+        static constexpr float DefaultDeltaTime = 1.0f / 60.0f;
+
+        /// @param gameCount Number of games owned by the batch
+        /// @param seed Base seed; game i draws from its own generator, reseeded with seed + i on every reset
+        /// @param deltaTime Simulated time advanced by each Step
+        explicit BatchEnvironment(std::size_t gameCount, uint64_t seed = 0,
+                                  float deltaTime = DefaultDeltaTime);
+
+        /// @brief Start a new game in every slot
+        void Reset();
+
+        /// @brief Start a new game in one slot, leaving the others untouched
+        ///
+        /// The game then plays exactly like CreateGameEngine(seed + game) after StartNewGame.
+        void ResetGame(std::size_t game);
+
+        /// @brief Advance every running game by one tick
+        /// @param actions Desired player direction per game (size must equal GetGameCount())
+        void Step(std::span<const Direction> actions);
+
+        std::size_t GetGameCount() const { return gameCount_; }
+        float GetDeltaTime() const { return deltaTime_; }
+
+        /// @brief Number of games still in GameState::Running
+        std::size_t GetRunningCount() const;
+
+        GameState GetState(std::size_t game) const { return static_cast<GameState>(gameState_[game]); }
+        int GetScore(std::size_t game) const { return score_[game]; }
+        int GetLives(std::size_t game) const { return lives_[game]; }
+        int GetPelletCount(std::size_t game) const { return pelletCount_[game]; }
+        Vector2 GetPlayerPosition(std::size_t game) const { return {playerX_[game], playerY_[game]}; }
+        Vector2 GetGhostPosition(std::size_t game, std::size_t ghost) const {
+            return {ghostX_[game * GhostCount + ghost], ghostY_[game * GhostCount + ghost]};
+        }
+        TileType GetTileAt(std::size_t game, const Vector2& position) const;
+
+        /// @brief Instruction set used for the ghost kernel, DetectSimdLevel() by default
+        SimdLevel GetSimdLevel() const { return simdLevel_; }
+
+        /// @brief Force a kernel path, capped at what the CPU supports; every path gives the same results
+        void SetSimdLevel(SimdLevel level);
+
+        PlayerState GetPlayerState(std::size_t game) const;
+        std::array<GhostState, GhostCount> GetGhostStates(std::size_t game) const;
+
+    private:
+        static constexpr int Width = GameConfig::MapWidth;
+        static constexpr int Height = GameConfig::MapHeight;
+        static constexpr int TileCount = Width * Height;
+
+        enum TileFlags : uint8_t {
+            WallFlag = 1 << 0,
+            DoorFlag = 1 << 1,
+            PelletFlag = 1 << 2,
+            PowerPelletFlag = 1 << 3
+        };
+
+        /// @brief Kernel inputs and outputs for one ghost type, one entry per game
+        struct KernelLanes {
+            std::vector<int16_t> GhostX;
+            std::vector<int16_t> GhostY;
+            std::vector<int16_t> Exits;
+            std::vector<int16_t> Chase;
+            std::vector<int16_t> PlayerX;
+            std::vector<int16_t> PlayerY;
+            std::vector<int16_t> PlayerDirection;
+            std::vector<int16_t> BlinkyX;
+            std::vector<int16_t> BlinkyY;
+            std::vector<int16_t> TargetX;
+            std::vector<int16_t> TargetY;
+            std::vector<int16_t> NewDirection;
+        };
+
+        void AdvanceModes(std::size_t game);
+        void ResetModes(std::size_t game);
+        void UpdateTickTimes(std::size_t game);
+        GhostMode GetMode(std::size_t game) const;
+        void StepPlayer(std::size_t game);
+        void UpdatePlayer(std::size_t game);
+        void ConsumeTile(std::size_t game, int index);
+        void StepGhosts();
+        void UpdateEatenGhost(std::size_t game, std::size_t ghost);
+        Direction ChooseFrightenedDirection(std::size_t game, std::size_t ghost);
+        void CheckCollisions(std::size_t game);
+        void HandlePlayerDeath(std::size_t game);
+        void InitializePlayer(std::size_t game);
+        void InitializeGhosts(std::size_t game);
+        float GetGhostInterval(std::size_t game) const;
+
+        void MoveGhost(std::size_t g, int tile) {
+            ghostX_[g] = static_cast<int8_t>(tile % Width);
+            ghostY_[g] = static_cast<int8_t>(tile / Width);
+        }
+
+        uint8_t FlagsAt(int x, int y) const {
+            if (x < 0 || y < 0 || x >= Width || y >= Height) return WallFlag;
+            return layout_[y * Width + x];
+        }
+
+        bool IsPelletAt(std::size_t game, int index) const {
+            return pellets_[game].Test(index);
+        }
+
+        std::size_t gameCount_;
+        uint64_t seed_;
+        float deltaTime_;
+        SimdLevel simdLevel_ = DetectSimdLevel();
+
+        // Immutable layout shared by every game
+        std::array<uint8_t, TileCount> layout_{};
+        MazeGraph graph_;
+        Bitboard initialPellets_;
+        int initialPelletCount_ = 0;
+
+        // Per-Step scratch, sized once so stepping never allocates
+        std::vector<uint8_t> due_;
+        std::vector<uint32_t> dueGames_;
+        std::vector<uint32_t> ghostGames_;
+        std::array<KernelLanes, GhostCount> lanes_;
+
+        // Per game
+        std::vector<uint8_t> gameState_;
+        std::vector<int8_t> playerX_;
+        std::vector<int8_t> playerY_;
+        std::vector<Direction> playerDirection_;
+        std::vector<Direction> desiredDirection_;
+        std::vector<uint8_t> poweredUp_;
+        std::vector<int32_t> score_;
+        std::vector<int8_t> lives_;
+        std::vector<int16_t> pelletCount_;
+        std::vector<Bitboard> pellets_;
+        std::vector<float> playerStepTimer_;
+        std::vector<float> ghostStepTimer_;
+        std::vector<float> ghostInterval_;
+        std::vector<Random> rng_;
+
+        // Per game time a Step adds to the clocks: deltaTime while running,
+        // and again to the frightened countdown while frightened; zero otherwise
+        std::vector<float> tickTime_;
+        std::vector<float> frightenedTickTime_;
+
+        // Per game scatter/chase waves and frightened mode, the state of a GhostModeController
+        std::vector<int8_t> wave_;
+        std::vector<uint8_t> scatter_;
+        std::vector<uint8_t> frightened_;
+        std::vector<float> waveTimer_;
+        std::vector<float> phaseDuration_;
+        std::vector<float> frightenedTimer_;
+
+        // Per game * GhostCount + ghost
+        std::vector<int8_t> ghostX_;
+        std::vector<int8_t> ghostY_;
+        std::vector<int8_t> ghostTargetX_;
+        std::vector<int8_t> ghostTargetY_;
+        std::vector<Direction> ghostDirection_;
+        std::vector<GhostMode> ghostMode_;
+        std::vector<uint8_t> ghostFrightened_;
+        std::vector<uint8_t> ghostEaten_;
+    };
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "GameConfig.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace Pacman {
+
+    /// @brief One bit per maze tile, row-major (index = y * MapWidth + x)
+    class Bitboard {
+    public:
+        static constexpr int BitCount = GameConfig::MapWidth * GameConfig::MapHeight;
+        static constexpr int WordCount = (BitCount + 63) / 64;
+
+        constexpr bool Test(int index) const {
+            return (words_[index >> 6] >> (index & 63)) & 1u;
+        }
+
+        constexpr void Set(int index) {
+            words_[index >> 6] |= uint64_t{1} << (index & 63);
+        }
+
+        constexpr void Reset(int index) {
+            words_[index >> 6] &= ~(uint64_t{1} << (index & 63));
+        }
+
+        constexpr void Clear() { words_.fill(0); }
+
+        /// @brief Number of set bits
+        constexpr int Count() const {
+            int count = 0;
+            for (uint64_t word : words_) count += std::popcount(word);
+            return count;
+        }
+
+        constexpr bool Any() const {
+            for (uint64_t word : words_) if (word) return true;
+            return false;
+        }
+
+        /// @brief Call fn(index) for every set bit in ascending order
+        template<typename Fn>
+        constexpr void ForEachSetBit(Fn&& fn) const {
+            for (int w = 0; w < WordCount; ++w) {
+                for (uint64_t word = words_[w]; word; word &= word - 1) {
+                    fn(w * 64 + std::countr_zero(word));
+                }
+            }
+        }
+
+        constexpr Bitboard operator|(const Bitboard& other) const {
+            Bitboard result;
+            for (int w = 0; w < WordCount; ++w) result.words_[w] = words_[w] | other.words_[w];
+            return result;
+        }
+
+        bool operator==(const Bitboard& other) const = default;
+
+    private:
+        std::array<uint64_t, WordCount> words_{};
+    };
+
+}
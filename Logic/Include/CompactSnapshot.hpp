@@ -0,0 +1,26 @@
+#pragma once
+
+#include "EngineSnapshot.hpp"
+#include "LevelData.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Pacman {
+
+    /// @brief Append a snapshot in compact form, about 150 bytes instead of sizeof(EngineSnapshot)
+    ///
+    /// The board is stored as one bit per pellet of the level's pristine
+    /// image (eaten or not), and every other field as a varint, zigzag
+    /// varint, raw float bits or a byte. Only boards that differ from the
+    /// level image by eaten pellets can be stored, which is every board the
+    /// engine produces on that level.
+    void EncodeCompactSnapshot(const EngineSnapshot& snapshot, const LevelData& level,
+                               std::vector<uint8_t>& out);
+
+    /// @brief Rebuild a snapshot written by EncodeCompactSnapshot for the same level
+    /// @return False, leaving snapshot unspecified, if the data is malformed
+    bool DecodeCompactSnapshot(std::span<const uint8_t> data, const LevelData& level,
+                               EngineSnapshot& snapshot);
+
+}
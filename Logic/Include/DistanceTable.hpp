@@ -0,0 +1,96 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include "LevelData.hpp"
+#include "MazeGraph.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Pacman {
+
+    /// @brief All-pairs maze distances and first steps, precomputed by BFS
+    ///
+    /// Covers every tile the given mover can stand on, follows the same exit
+    /// masks as the engine (tunnel wrap, ghost door rules) and answers each
+    /// query with one array lookup. Distances are stored as uint8_t and tiles
+    /// are remapped to a dense uint16_t node index, so the default maze needs
+    /// about 2 bytes per pair. Immutable after construction; share one copy.
+    ///
+    /// A table either owns its arrays (built by BFS) or views arrays owned by
+    /// someone else, such as a memory-mapped LevelPack; queries do not care.
+    class DistanceTable {
+    public:
+        static constexpr int Unreachable = -1;
+
+        /// @brief Build the table for a level by running a BFS from every tile
+        DistanceTable(const LevelData& level, MazeGraph::Mover mover);
+
+        /// @brief View precomputed arrays laid out as GetNodeMap/GetDistances/GetNextHops
+        /// return them; the caller keeps the memory alive for the table's lifetime
+        DistanceTable(MazeGraph::Mover mover, int nodeCount,
+                      std::span<const uint16_t> nodeMap,
+                      std::span<const uint8_t> distances,
+                      std::span<const Direction> nextHops);
+
+        // Views would dangle into the source's storage
+        DistanceTable(const DistanceTable&) = delete;
+        DistanceTable& operator=(const DistanceTable&) = delete;
+
+        /// @brief Number of tiles the mover can stand on
+        int GetNodeCount() const { return nodeCount_; }
+
+        /// @brief Steps along the maze from one tile index to another, or Unreachable
+        int GetDistance(int fromTile, int toTile) const {
+            int from = nodeOf_[fromTile];
+            int to = nodeOf_[toTile];
+            if (from == NoNode || to == NoNode) return Unreachable;
+            uint8_t distance = distances_[from * nodeCount_ + to];
+            return distance == UnreachableDistance ? Unreachable : distance;
+        }
+
+        int GetDistance(const Vector2& from, const Vector2& to) const {
+            if (!IsInMaze(from) || !IsInMaze(to)) return Unreachable;
+            return GetDistance(MazeGraph::ToIndex(from), MazeGraph::ToIndex(to));
+        }
+
+        /// @brief First direction of a shortest path, or Direction::None if already there or unreachable
+        Direction GetNextHop(int fromTile, int toTile) const {
+            int from = nodeOf_[fromTile];
+            int to = nodeOf_[toTile];
+            if (from == NoNode || to == NoNode) return Direction::None;
+            return nextHops_[from * nodeCount_ + to];
+        }
+
+        Direction GetNextHop(const Vector2& from, const Vector2& to) const {
+            if (!IsInMaze(from) || !IsInMaze(to)) return Direction::None;
+            return GetNextHop(MazeGraph::ToIndex(from), MazeGraph::ToIndex(to));
+        }
+
+        MazeGraph::Mover GetMover() const { return mover_; }
+
+        /// @brief Raw arrays, for serialization
+        std::span<const uint16_t> GetNodeMap() const { return nodeOf_; }
+        std::span<const uint8_t> GetDistances() const { return distances_; }
+        std::span<const Direction> GetNextHops() const { return nextHops_; }
+
+        static constexpr uint16_t NoNode = 0xFFFF;
+        static constexpr uint8_t UnreachableDistance = 0xFF;
+
+    private:
+        static bool IsInMaze(const Vector2& pos) {
+            return pos.X >= 0 && pos.Y >= 0 && pos.X < MazeGraph::Width && pos.Y < MazeGraph::Height;
+        }
+
+        MazeGraph::Mover mover_;
+        int nodeCount_ = 0;
+        std::span<const uint16_t> nodeOf_;
+        std::span<const uint8_t> distances_;
+        std::span<const Direction> nextHops_;
+        // Empty when viewing external memory
+        std::vector<uint16_t> ownedNodeOf_;
+        std::vector<uint8_t> ownedDistances_;
+        std::vector<Direction> ownedNextHops_;
+    };
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include "GhostModeController.hpp"
+#include "Map.hpp"
+#include "Random.hpp"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace Pacman {
+
+    /// @brief Complete dynamic state of a game engine
+    ///
+    /// Plain data with no pointers or owned memory: it can be copied with
+    /// memcpy, kept in flat arrays and restored into any engine. Listeners,
+    /// ghost AIs and queued input are not part of it.
+    struct EngineSnapshot {
+        Map Board;
+        PlayerState Player{};
+        Direction DesiredDirection = Direction::None;
+        std::array<GhostState, 4> Ghosts{};
+        GhostModeController ModeController{};
+        GameState State = GameState::Paused;
+        int GhostsEatenThisPowerUp = 0;
+        float PlayerStepTimer = 0.0f;
+        float GhostStepTimer = 0.0f;
+        uint64_t Seed = 0;
+        Random Rng{};
+        // Level within the pack the snapshot was taken from; restoring on an
+        // engine with another pack is meaningless. The Board already holds its tiles
+        uint32_t LevelIndex = 0;
+        // Update calls since StartNewGame, as numbered in the input log
+        uint32_t Tick = 0;
+    };
+
+    static_assert(std::is_trivially_copyable_v<EngineSnapshot>);
+    static_assert(std::is_standard_layout_v<EngineSnapshot>);
+
+}
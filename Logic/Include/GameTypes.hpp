@@ -2,12 +2,14 @@
 
 #include <cmath>
 #include <cstdint>
-#include <string>
+#include <array>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace Pacman {
 
-    enum class Direction {
+    enum class Direction : uint8_t {
         Up,
         Down,
         Left,
@@ -15,7 +17,7 @@ namespace Pacman {
         None
     };
 
-    enum class TileType {
+    enum class TileType : uint8_t {
         Wall,
         Path,
         Pellet,
@@ -24,21 +26,21 @@ namespace Pacman {
         GhostDoor
     };
 
-    enum class GameState {
+    enum class GameState : uint8_t {
         Running,
         Paused,
         GameOver,
         Victory
     };
 
-    enum class GhostType {
+    enum class GhostType : uint8_t {
         Red,
         Pink,
         Blue,
         Orange
     };
 
-    enum class GhostMode {
+    enum class GhostMode : uint8_t {
         Scatter,
         Chase,
         Frightened,
@@ -49,27 +51,27 @@ namespace Pacman {
         int X = 0;
         int Y = 0;
 
-        bool operator==(const Vector2& other) const {
+        constexpr bool operator==(const Vector2& other) const {
             return X == other.X && Y == other.Y;
         }
 
-        bool operator!=(const Vector2& other) const {
+        constexpr bool operator!=(const Vector2& other) const {
             return !(*this == other);
         }
 
-        Vector2 operator+(const Vector2& other) const {
+        constexpr Vector2 operator+(const Vector2& other) const {
             return {X + other.X, Y + other.Y};
         }
 
-        Vector2 operator-(const Vector2& other) const {
+        constexpr Vector2 operator-(const Vector2& other) const {
             return {X - other.X, Y - other.Y};
         }
 
-        Vector2 operator*(int scalar) const {
+        constexpr Vector2 operator*(int scalar) const {
             return {X * scalar, Y * scalar};
         }
 
-        int DistanceSquared(const Vector2& other) const {
+        constexpr int DistanceSquared(const Vector2& other) const {
             int dx = X - other.X;
             int dy = Y - other.Y;
             return dx * dx + dy * dy;
@@ -79,7 +81,7 @@ namespace Pacman {
             return std::sqrt(static_cast<float>(DistanceSquared(other)));
         }
 
-        bool operator<(const Vector2& other) const {
+        constexpr bool operator<(const Vector2& other) const {
             if (X < other.X) return true;
             if (X > other.X) return false;
             return Y < other.Y;
@@ -93,25 +95,35 @@ namespace Pacman {
 
     struct PlayerState {
         Vector2 Position{0, 0};
-        Direction CurrentDirection = Direction::None;
         int Score = 0;
-        bool IsPoweredUp = false;
         int Lives = 3;
+        Direction CurrentDirection = Direction::None;
+        bool IsPoweredUp = false;
     };
 
+    /// @brief Ghost state; plain data, four of them fill exactly two cache lines
     struct GhostState {
         Vector2 Position{0, 0};
+        Vector2 TargetTile{0, 0};
+        Vector2 ScatterTarget{0, 0};
         Direction CurrentDirection = Direction::None;
-        bool IsFrightened = false;
-        bool IsEaten = false;
         GhostType Type = GhostType::Red;
         GhostMode Mode = GhostMode::Scatter;
-        std::string Name;
-        Vector2 TargetTile{0, 0};
-        Vector2 ScatterTarget{0, 0};
+        bool IsFrightened = false;
+        bool IsEaten = false;
     };
 
-    inline Vector2 GetDirectionDelta(Direction dir) {
+    static_assert(std::is_trivially_copyable_v<PlayerState> && sizeof(PlayerState) <= 20);
+    static_assert(std::is_trivially_copyable_v<GhostState> && sizeof(GhostState) == 32);
+
+    inline constexpr std::array<std::string_view, 4> GhostNames = {"Red", "Pink", "Blue", "Orange"};
+
+    /// @brief Display name of a ghost type
+    constexpr std::string_view GetGhostName(GhostType type) {
+        return GhostNames[static_cast<size_t>(type)];
+    }
+
+    constexpr Vector2 GetDirectionDelta(Direction dir) {
         switch (dir) {
         case Direction::Up:    return {0, -1};
         case Direction::Down:  return {0, 1};
@@ -121,7 +133,7 @@ namespace Pacman {
         }
     }
 
-    inline Direction GetOppositeDirection(Direction dir) {
+    constexpr Direction GetOppositeDirection(Direction dir) {
         switch (dir) {
         case Direction::Up:    return Direction::Down;
         case Direction::Down:  return Direction::Up;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Pacman {
+
+    /// @brief Instruction sets the ghost kernel can run on
+    enum class SimdLevel : uint8_t {
+        Scalar,
+        Sse2,   // 8 games per instruction
+        Avx2    // 16 games per instruction
+    };
+
+    /// @brief Best level the running CPU supports
+    SimdLevel DetectSimdLevel();
+
+    /// @brief One ghost type across many games, one int16_t lane per game
+    ///
+    /// Every pointer addresses Count elements. Only ghosts that are neither
+    /// eaten nor frightened belong here: their step is pure integer math, while
+    /// the other two cases draw random numbers or head home and stay scalar.
+    /// Positions must be on the board so every intermediate fits in 16 bits.
+    struct GhostKernelBatch {
+        GhostType Type = GhostType::Red;
+        Vector2 ScatterTarget;
+        std::size_t Count = 0;
+
+        const int16_t* GhostX = nullptr;
+        const int16_t* GhostY = nullptr;
+        // Ghost exit mask (MazeGraph::ExitBit) with the reverse direction removed
+        const int16_t* Exits = nullptr;
+        // Nonzero to apply the chase rule, zero to head for ScatterTarget
+        const int16_t* Chase = nullptr;
+        const int16_t* PlayerX = nullptr;
+        const int16_t* PlayerY = nullptr;
+        const int16_t* PlayerDirection = nullptr;
+        const int16_t* BlinkyX = nullptr;
+        const int16_t* BlinkyY = nullptr;
+
+        int16_t* TargetX = nullptr;
+        int16_t* TargetY = nullptr;
+        // Direction as int16_t; Direction::None if no exit is open
+        int16_t* NewDirection = nullptr;
+    };
+
+    /// @brief Compute chase/scatter targets and the chosen direction for every lane
+    ///
+    /// Produces exactly what GameEngine computes for the same ghost: the
+    /// GhostStrategies rules, then the exit closest to the target with ties
+    /// broken Up, Left, Down, Right. Levels above DetectSimdLevel() fall back
+    /// to the best supported one.
+    void RunGhostKernel(const GhostKernelBatch& batch, SimdLevel level);
+
+}
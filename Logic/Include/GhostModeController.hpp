@@ -80,6 +80,32 @@ namespace Pacman {
             return isFrightened_ && frightenedTimer_ <= GameConfig::PowerUpWarningTime;
         }
 
+        /// @brief Every timer and flag, for serializing snapshots
+        struct State {
+            int CurrentWave = 0;
+            float WaveTimer = 0.0f;
+            float FrightenedTimer = 0.0f;
+            bool IsScatterPhase = true;
+            bool IsPermanentChase = false;
+            bool ModeJustChanged = false;
+            bool IsFrightened = false;
+        };
+
+        State GetState() const {
+            return {currentWave_, waveTimer_, frightenedTimer_,
+                    isScatterPhase_, isPermanentChase_, modeJustChanged_, isFrightened_};
+        }
+
+        void SetState(const State& state) {
+            currentWave_ = state.CurrentWave;
+            waveTimer_ = state.WaveTimer;
+            frightenedTimer_ = state.FrightenedTimer;
+            isScatterPhase_ = state.IsScatterPhase;
+            isPermanentChase_ = state.IsPermanentChase;
+            modeJustChanged_ = state.ModeJustChanged;
+            isFrightened_ = state.IsFrightened;
+        }
+
     private:
         float GetCurrentPhaseDuration() const {
             if (currentWave_ >= GameConfig::ScatterChaseWaves) return 99999.0f;
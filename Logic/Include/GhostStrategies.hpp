@@ -0,0 +1,100 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include "GameConfig.hpp"
+#include "IGhost.hpp"
+#include <memory>
+#include <variant>
+
+namespace Pacman {
+
+    /// @brief Built-in chase rules as plain value types
+    ///
+    /// These are the rules the IGhost implementations in Ghost.cpp forward to,
+    /// except that OrangeAI retreats to its own GetScatterTarget().
+    /// Held in a GhostStrategy variant they are dispatched with a switch on the
+    /// variant index instead of a virtual call, so the engine's ghost step can
+    /// inline them.
+    struct RedStrategy {
+        static constexpr GhostType Type = GhostType::Red;
+
+        static constexpr Vector2 ChaseTarget(const GhostState&, const PlayerState& player, const Vector2&) {
+            return player.Position;
+        }
+    };
+
+    struct PinkStrategy {
+        static constexpr GhostType Type = GhostType::Pink;
+
+        static constexpr Vector2 ChaseTarget(const GhostState&, const PlayerState& player, const Vector2&) {
+            Vector2 delta = GetDirectionDelta(player.CurrentDirection);
+            Vector2 target = player.Position + delta * GameConfig::PinkTargetAhead;
+            // Original arcade overflow: looking up also looks left
+            if (player.CurrentDirection == Direction::Up) {
+                target.X -= GameConfig::PinkTargetAhead;
+            }
+            return target;
+        }
+    };
+
+    struct BlueStrategy {
+        static constexpr GhostType Type = GhostType::Blue;
+
+        static constexpr Vector2 ChaseTarget(const GhostState&, const PlayerState& player, const Vector2& redPosition) {
+            Vector2 delta = GetDirectionDelta(player.CurrentDirection);
+            Vector2 pivot = player.Position + delta * GameConfig::BlueTargetAhead;
+            if (player.CurrentDirection == Direction::Up) {
+                pivot.X -= GameConfig::BlueTargetAhead;
+            }
+            return {2 * pivot.X - redPosition.X, 2 * pivot.Y - redPosition.Y};
+        }
+    };
+
+    struct OrangeStrategy {
+        static constexpr GhostType Type = GhostType::Orange;
+
+        /// @brief Whether the ghost is close enough to the player to retreat to its corner
+        static constexpr bool IsShy(const GhostState& ghost, const PlayerState& player) {
+            constexpr int ShyDistanceSq = GameConfig::OrangeShyDistance * GameConfig::OrangeShyDistance;
+            return ghost.Position.DistanceSquared(player.Position) <= ShyDistanceSq;
+        }
+
+        static constexpr Vector2 ChaseTarget(const GhostState& ghost, const PlayerState& player, const Vector2&) {
+            // In the engine the level decides where the corner is
+            return IsShy(ghost, player) ? ghost.ScatterTarget : player.Position;
+        }
+    };
+
+    /// @brief User-supplied IGhost, called through its vtable
+    struct CustomStrategy {
+        std::shared_ptr<const IGhost> Ghost;
+
+        Vector2 ChaseTarget(const GhostState& ghost, const PlayerState& player, const Vector2& redPosition) const {
+            return Ghost->CalculateChaseTarget(ghost, player, redPosition);
+        }
+    };
+
+    using GhostStrategy = std::variant<RedStrategy, PinkStrategy, BlueStrategy, OrangeStrategy, CustomStrategy>;
+
+    /// @brief Built-in strategy for a ghost type
+    constexpr GhostStrategy MakeGhostStrategy(GhostType type) {
+        switch (type) {
+            case GhostType::Pink:   return PinkStrategy{};
+            case GhostType::Blue:   return BlueStrategy{};
+            case GhostType::Orange: return OrangeStrategy{};
+            default:                return RedStrategy{};
+        }
+    }
+
+    inline Vector2 CalculateChaseTarget(const GhostStrategy& strategy, const GhostState& ghost,
+                                        const PlayerState& player, const Vector2& redPosition) {
+        switch (strategy.index()) {
+            case 0: return RedStrategy::ChaseTarget(ghost, player, redPosition);
+            case 1: return PinkStrategy::ChaseTarget(ghost, player, redPosition);
+            case 2: return BlueStrategy::ChaseTarget(ghost, player, redPosition);
+            case 3: return OrangeStrategy::ChaseTarget(ghost, player, redPosition);
+            default: return std::get_if<CustomStrategy>(&strategy)->ChaseTarget(ghost, player, redPosition);
+        }
+    }
+
+}
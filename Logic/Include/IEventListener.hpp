@@ -1,7 +1,8 @@
 #pragma once
 
 #include "GameTypes.hpp"
-#include <vector>
+#include "InputLog.hpp"
+#include <span>
 
 namespace Pacman {
 
@@ -23,10 +24,20 @@ namespace Pacman {
         virtual void OnGameStateChanged(GameState state) = 0;
 
         /// @brief Called when ghost positions/states update
-        /// @param ghosts The current ghost states
-        virtual void OnGhostsUpdated(const std::vector<GhostState>& ghosts) = 0;
+        /// @param ghosts The current ghost states; a view of engine-owned storage that is
+        /// only valid during the call, so copy anything that must outlive it
+        virtual void OnGhostsUpdated(std::span<const GhostState> ghosts) = 0;
 
         virtual void OnGhostModeChanged(GhostMode mode) {}
+
+        /// @brief Called when LoadLevel has swapped the maze and reset the board,
+        /// before the state notifications that describe the new board
+        /// @param levelIndex Index of the new level in its pack
+        virtual void OnLevelLoaded(uint32_t) {}
+
+        /// @brief Called for every entry the engine adds to its input log
+        /// @param entry The entry; see InputLogEntry for when each type is logged
+        virtual void OnInputLogged(const InputLogEntry&) {}
     };
 
 }
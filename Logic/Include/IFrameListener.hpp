@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include <span>
+
+namespace Pacman {
+
+    /// @brief Everything that changed during one engine call
+    ///
+    /// The spans view engine-owned buffers and are only valid for the
+    /// duration of IFrameListener::OnFrame.
+    struct FrameDelta {
+        /// @brief Tiles emptied this frame, in the order they were eaten
+        std::span<const TileUpdate> EatenTiles;
+        /// @brief Ghost mode transitions this frame, in order
+        std::span<const GhostMode> ModeTransitions;
+        /// @brief Current player state, whether or not it changed
+        PlayerState Player{};
+        /// @brief Current ghost states, whether or not they changed
+        std::span<const GhostState> Ghosts;
+        GameState State = GameState::Paused;
+        bool PlayerChanged = false;
+        bool GhostsChanged = false;
+        bool StateChanged = false;
+    };
+
+    /// @brief Opt-in alternative to IEventListener that receives one coalesced
+    /// event per Update (and per StartNewGame and LoadLevel) instead of
+    /// individual callbacks
+    class IFrameListener {
+    public:
+        virtual ~IFrameListener() = default;
+
+        /// @brief Called once at the end of every Update, StartNewGame and successful LoadLevel
+        ///
+        /// The frame of a LoadLevel carries the fresh game on the new maze but
+        /// no tile changes; read the board from the engine again after it.
+        /// @param frame The changes made during that call
+        virtual void OnFrame(const FrameDelta& frame) = 0;
+    };
+
+}
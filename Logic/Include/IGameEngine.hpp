@@ -1,7 +1,13 @@
 #pragma once
 
 #include "GameTypes.hpp"
+#include "DistanceTable.hpp"
+#include "EngineSnapshot.hpp"
 #include "IEventListener.hpp"
+#include "IFrameListener.hpp"
+#include "IGhost.hpp"
+#include "LevelPack.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -9,11 +15,23 @@ namespace Pacman {
 
     class IGameEngine {
     public:
+        /// @brief Ticks between keyframes in the input log unless changed
+        static constexpr uint32_t DefaultKeyframeInterval = 600;
+
         virtual ~IGameEngine() = default;
 
         virtual void StartNewGame() = 0;
         virtual void Update(float deltaTime) = 0;
+
+        /// @brief Request pause/resume; lock-free, applied at the start of the next Update
         virtual void SetPaused(bool isPaused) = 0;
+
+        /// @brief Request the opposite of the pause state the next Update would
+        /// otherwise leave; lock-free, so two toggles before an Update cancel out
+        virtual void TogglePaused() = 0;
+
+        /// @brief Set the desired player direction; lock-free, applied at the start
+        /// of the next Update so the caller never waits for a tick in progress
         virtual void SetPlayerDirection(Direction direction) = 0;
 
         virtual GameState GetState() const = 0;
@@ -25,10 +43,79 @@ namespace Pacman {
         virtual std::vector<GhostState> GetGhostStates() const = 0;
         virtual GhostMode GetGlobalGhostMode() const = 0;
 
+        /// @brief Like GetPelletPositions, into a caller-owned vector whose
+        /// capacity is reused; the engine's version never allocates once the
+        /// vector has held every pellet
+        virtual void CopyPelletPositions(std::vector<Vector2>& positions) const {
+            positions = GetPelletPositions();
+        }
+
+        /// @brief Like GetGhostStates, into a caller-owned vector whose capacity is reused
+        virtual void CopyGhostStates(std::vector<GhostState>& states) const {
+            states = GetGhostStates();
+        }
+
+        /// @brief Copy the full dynamic state into a caller-owned snapshot; never allocates
+        ///
+        /// Input set since the last Update is not part of the state and is not saved.
+        virtual void SaveSnapshot(EngineSnapshot& snapshot) const = 0;
+
+        /// @brief Replace the dynamic state with a snapshot; listeners are not notified
+        /// and any queued input is discarded
+        ///
+        /// A snapshot is only valid on the level pack it was taken from: its
+        /// LevelIndex is looked up in this engine's pack. Returns false, changing
+        /// nothing, if that pack has no such level.
+        virtual bool RestoreSnapshot(const EngineSnapshot& snapshot) = 0;
+
+        /// @brief Independent engine in the same state, sharing the immutable ghost AIs;
+        /// listeners are not copied, input queued for the next Update is
+        virtual std::shared_ptr<IGameEngine> Clone() const = 0;
+
+        /// @brief Maze distances and next hops under the given movement rules
+        ///
+        /// Built on first request and shared by every engine on the same maze,
+        /// so agents and ghost strategies can hold on to the returned table.
+        virtual std::shared_ptr<const DistanceTable> GetDistanceTable(MazeGraph::Mover mover) const = 0;
+
+        /// @brief Switch to another maze, sharing the pack's read-only data
+        ///
+        /// The engine is reset to a fresh, paused game on the new maze; call
+        /// StartNewGame to play it. Returns false, changing nothing, if the
+        /// pack is null or has no such level.
+        virtual bool LoadLevel(std::shared_ptr<const LevelPack> pack, uint32_t index) = 0;
+
+        /// @brief Index of the current maze within its pack (0 for the built-in maze)
+        virtual uint32_t GetLevelIndex() const = 0;
+
+        /// @brief Replace the chase rule of one ghost with a custom strategy
+        ///
+        /// Pass nullptr to go back to the built-in rule. Built-in rules are
+        /// called without virtual dispatch; a custom AI costs one virtual call
+        /// per ghost step. Clones share the custom AI.
+        virtual void SetGhostAI(GhostType type, std::shared_ptr<const IGhost> ai) = 0;
+
+        /// @brief Log a keyframe every given number of ticks so replays can seek; 0 turns them off
+        ///
+        /// Keyframes are only built while listeners are attached.
+        virtual void SetKeyframeInterval(uint32_t ticks) = 0;
+
+        /// @brief Seed the engine was created with; StartNewGame restarts the random sequence from it
+        virtual uint64_t GetSeed() const = 0;
+
         virtual void AddListener(std::shared_ptr<IEventListener> listener) = 0;
         virtual void RemoveListener(std::shared_ptr<IEventListener> listener) = 0;
+
+        /// @brief Register a listener for coalesced per-frame events
+        virtual void AddFrameListener(std::shared_ptr<IFrameListener> listener) = 0;
+        virtual void RemoveFrameListener(std::shared_ptr<IFrameListener> listener) = 0;
     };
 
+    /// @brief Engine seeded from std::random_device
     std::shared_ptr<IGameEngine> CreateGameEngine();
 
+    /// @brief Deterministic engine: the same seed and the same sequence of
+    /// SetPlayerDirection/SetPaused/Update calls produce bit-identical states
+    std::shared_ptr<IGameEngine> CreateGameEngine(uint64_t seed);
+
 }
\ No newline at end of file
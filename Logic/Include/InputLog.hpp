@@ -0,0 +1,54 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include <cstdint>
+
+namespace Pacman {
+
+    struct EngineSnapshot;
+    struct LevelData;
+
+    enum class InputLogType : uint8_t {
+        GameStarted,
+        Direction,
+        Paused,
+        Resumed,
+        DeltaTime,
+        GameEnded,
+        Keyframe
+    };
+
+    /// @brief One entry of the engine's input log
+    ///
+    /// A tick is one Update call, counted from StartNewGame. The log holds
+    /// only what changes the outcome: the seed and maze of the game, each
+    /// input that changed the desired direction or the pause state in the
+    /// Update that applied it, and every change of deltaTime. Replaying the
+    /// entries into a fresh engine reproduces the game exactly. Keyframes,
+    /// logged every few hundred ticks, let a replay start from the middle.
+    struct InputLogEntry {
+        InputLogType Type = InputLogType::Direction;
+        uint32_t Tick = 0;
+
+        /// @brief Direction: the newly desired direction
+        Direction Input = Direction::None;
+        /// @brief DeltaTime: the value passed to Update from this tick on;
+        /// Keyframe: the value in effect before this tick's DeltaTime entry, if any
+        float DeltaTime = 0.0f;
+
+        /// @brief GameStarted: what the engine was seeded with and which maze of its pack it plays
+        uint64_t Seed = 0;
+        uint32_t LevelIndex = 0;
+
+        /// @brief GameEnded: final state, for checking a replay; Tick is the number of ticks played
+        GameState State = GameState::Running;
+        PlayerState Player{};
+        int PelletCount = 0;
+
+        /// @brief Keyframe: full state after Tick updates, and the level it is played on.
+        /// Both point into the engine and are only valid during the callback.
+        const EngineSnapshot* Snapshot = nullptr;
+        const LevelData* Level = nullptr;
+    };
+
+}
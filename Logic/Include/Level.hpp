@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Bitboard.hpp"
+#include "GameConfig.hpp"
+#include <array>
+#include <string_view>
+
+namespace Pacman {
+
+    /// @brief Pristine tile layers of a level, ready to be copied into a Map
+    struct LevelImage {
+        Bitboard Walls;
+        Bitboard Doors;
+        Bitboard Pellets;
+        Bitboard PowerPellets;
+        int PelletCount = 0;
+    };
+
+    using LevelRows = std::array<std::string_view, GameConfig::MapHeight>;
+
+    /// @brief Build a LevelImage from ASCII rows
+    ///
+    /// '#' wall, '.' pellet, 'o' power pellet, '-' ghost door; anything else
+    /// (including 'G' for the ghost house interior and short rows) is a path.
+    constexpr LevelImage ParseLevel(const LevelRows& rows) {
+        LevelImage level;
+        for (int y = 0; y < GameConfig::MapHeight; ++y) {
+            for (int x = 0; x < GameConfig::MapWidth; ++x) {
+                char c = (x < static_cast<int>(rows[y].size())) ? rows[y][x] : ' ';
+                int index = y * GameConfig::MapWidth + x;
+
+                switch (c) {
+                    case '#': level.Walls.Set(index); break;
+                    case '.': level.Pellets.Set(index); break;
+                    case 'o': level.PowerPellets.Set(index); break;
+                    case '-': level.Doors.Set(index); break;
+                    default:  break;
+                }
+            }
+        }
+        level.PelletCount = level.Pellets.Count() + level.PowerPellets.Count();
+        return level;
+    }
+
+    inline constexpr LevelRows DefaultLevelRows = {
+        "############################",
+        "#............##............#",
+        "#.####.#####.##.#####.####.#",
+        "#o####.#####.##.#####.####o#",
+        "#.####.#####.##.#####.####.#",
+        "#..........................#",
+        "#.####.##.########.##.####.#",
+        "#.####.##.########.##.####.#",
+        "#......##....##....##......#",
+        "######.##### ## #####.######",
+        "######.##### ## #####.######",
+        "######.##          ##.######",
+        "######.## ###--### ##.######",
+        "######.##  #GGGG#  ##.######",
+        "      .    #GGGG#    .      ",
+        "######.##  #GGGG#  ##.######",
+        "######.## ######## ##.######",
+        "######.##          ##.######",
+        "######.## ######## ##.######",
+        "######.## ######## ##.######",
+        "#............##............#",
+        "#.####.#####.##.#####.####.#",
+        "#.####.#####.##.#####.####.#",
+        "#o..##.......  .......##..o#",
+        "###.##.##.########.##.##.###",
+        "###.##.##.########.##.##.###",
+        "#......##....##....##......#",
+        "#.##########.##.##########.#",
+        "#.##########.##.##########.#",
+        "#..........................#",
+        "############################"
+    };
+
+    /// @brief The built-in maze, parsed at compile time
+    inline constexpr LevelImage DefaultLevel = ParseLevel(DefaultLevelRows);
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include "GameConfig.hpp"
+#include "Level.hpp"
+#include "Map.hpp"
+#include "MazeGraph.hpp"
+#include <array>
+#include <type_traits>
+
+namespace Pacman {
+
+    /// @brief Spawn point of one ghost, in GhostType order
+    struct GhostSpawn {
+        Vector2 Position;
+        Direction StartDirection = Direction::None;
+    };
+
+    /// @brief Everything an engine needs to play one maze
+    ///
+    /// Plain data with no pointers, so a level pack can store it verbatim and
+    /// engines can read it straight out of a read-only file mapping.
+    struct LevelData {
+        LevelImage Image;
+        Vector2 PlayerStart;
+        Direction PlayerStartDirection = Direction::Left;
+        std::array<GhostSpawn, 4> GhostSpawns{};
+        std::array<Vector2, 4> ScatterTargets{};
+        // Eaten ghosts head for the door and respawn at the house center
+        Vector2 GhostHouse;
+        Vector2 GhostHouseDoor;
+        MazeGraph::HouseArea GhostHouseArea{};
+        MazeGraph Graph;
+    };
+
+    static_assert(std::is_trivially_copyable_v<LevelData>);
+    static_assert(std::is_standard_layout_v<LevelData>);
+
+    /// @brief Assemble a LevelData, deriving the movement tables from the tiles
+    constexpr LevelData MakeLevelData(const LevelImage& image,
+                                      Vector2 playerStart,
+                                      const std::array<GhostSpawn, 4>& ghostSpawns,
+                                      const std::array<Vector2, 4>& scatterTargets,
+                                      Vector2 ghostHouse,
+                                      Vector2 ghostHouseDoor,
+                                      const MazeGraph::HouseArea& houseArea = MazeGraph::DefaultHouseArea) {
+        return LevelData{
+            .Image = image,
+            .PlayerStart = playerStart,
+            .PlayerStartDirection = Direction::Left,
+            .GhostSpawns = ghostSpawns,
+            .ScatterTargets = scatterTargets,
+            .GhostHouse = ghostHouse,
+            .GhostHouseDoor = ghostHouseDoor,
+            .GhostHouseArea = houseArea,
+            .Graph = MazeGraph(Map(image), houseArea)
+        };
+    }
+
+    /// @brief The built-in maze with its classic spawn points, computed at compile time
+    inline constexpr LevelData DefaultLevelData = MakeLevelData(
+        DefaultLevel,
+        {GameConfig::PlayerStartX, GameConfig::PlayerStartY},
+        {{{{13, 11}, Direction::Left},
+          {{13, 14}, Direction::Down},
+          {{11, 14}, Direction::Up},
+          {{15, 14}, Direction::Up}}},
+        {{{GameConfig::RedScatterX, GameConfig::RedScatterY},
+          {GameConfig::PinkScatterX, GameConfig::PinkScatterY},
+          {GameConfig::BlueScatterX, GameConfig::BlueScatterY},
+          {GameConfig::OrangeScatterX, GameConfig::OrangeScatterY}}},
+        {GameConfig::GhostHouseX, GameConfig::GhostHouseY},
+        {GameConfig::GhostHouseX, GameConfig::GhostHouseDoorY});
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "DistanceTable.hpp"
+#include "LevelData.hpp"
+#include "MazeGraph.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+
+namespace Pacman {
+
+    /// @brief Read-only collection of mazes, shared by every engine that plays them
+    ///
+    /// A pack file stores each LevelData verbatim, followed by the node map,
+    /// distances and next hops of its three DistanceTables. Open() maps the
+    /// file and points straight into it: nothing is parsed or copied, so any
+    /// number of engines (and processes) share the same pages and switching
+    /// maze is a pointer change. The format uses native byte order and struct
+    /// layout, and is rejected if sizeof(LevelData) does not match; build packs
+    /// with the same toolchain that reads them.
+    class LevelPack : public std::enable_shared_from_this<LevelPack> {
+    public:
+        static constexpr uint32_t FormatVersion = 1;
+
+        /// @brief Pack holding only the built-in maze; its distance tables are built on first use
+        static std::shared_ptr<const LevelPack> BuiltIn();
+
+        /// @brief Map a pack file; nullptr if it is missing, truncated or was written
+        /// with a different format or LevelData layout
+        static std::shared_ptr<const LevelPack> Open(const std::string& path);
+
+        /// @brief Write levels together with their precomputed distance tables
+        static bool Write(const std::string& path, std::span<const LevelData> levels);
+
+        ~LevelPack();
+
+        LevelPack(const LevelPack&) = delete;
+        LevelPack& operator=(const LevelPack&) = delete;
+
+        uint32_t GetLevelCount() const { return levelCount_; }
+        const LevelData& GetLevel(uint32_t index) const { return *entries_[index].Level; }
+
+        /// @brief Distance table of one level; the returned pointer keeps the pack alive
+        std::shared_ptr<const DistanceTable> GetDistanceTable(uint32_t index, MazeGraph::Mover mover) const;
+
+        /// @brief True when the levels live in a file mapping rather than in the program image
+        bool IsMapped() const { return mapping_ != nullptr; }
+
+    private:
+        struct NavSection;
+
+        struct Entry {
+            const LevelData* Level = nullptr;
+            // Null for levels without precomputed tables
+            const NavSection* Nav = nullptr;
+            std::array<std::once_flag, 3> TableFlags;
+            std::array<std::unique_ptr<const DistanceTable>, 3> Tables;
+        };
+
+        LevelPack() = default;
+
+        void* mapping_ = nullptr;
+        std::size_t mappingSize_ = 0;
+        uint32_t levelCount_ = 0;
+        std::unique_ptr<Entry[]> entries_;
+    };
+
+}
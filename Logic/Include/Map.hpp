@@ -1,141 +1,132 @@
 #pragma once
 
 #include "GameTypes.hpp"
+#include "GameConfig.hpp"
+#include "Bitboard.hpp"
+#include "Level.hpp"
 #include <vector>
-#include <string>
-#include <array>
 
 namespace Pacman {
 
+    /// @brief Maze tiles stored as one bitboard per tile kind
+    ///
+    /// Plain data (about 570 bytes), so it can be copied wholesale into snapshots.
     class Map {
     public:
-        Map() { Initialize(); }
-
-        void Initialize() {
-            static const std::array<std::string, 31> LEVEL = {{
-                "############################",
-                "#............##............#",
-                "#.####.#####.##.#####.####.#",
-                "#o####.#####.##.#####.####o#",
-                "#.####.#####.##.#####.####.#",
-                "#..........................#",
-                "#.####.##.########.##.####.#",
-                "#.####.##.########.##.####.#",
-                "#......##....##....##......#",
-                "######.##### ## #####.######",
-                "######.##### ## #####.######",
-                "######.##          ##.######",
-                "######.## ###--### ##.######",
-                "######.##  #GGGG#  ##.######",
-                "      .    #GGGG#    .      ",
-                "######.##  #GGGG#  ##.######",
-                "######.## ######## ##.######",
-                "######.##          ##.######",
-                "######.## ######## ##.######",
-                "######.## ######## ##.######",
-                "#............##............#",
-                "#.####.#####.##.#####.####.#",
-                "#.####.#####.##.#####.####.#",
-                "#o..##.......  .......##..o#",
-                "###.##.##.########.##.##.###",
-                "###.##.##.########.##.##.###",
-                "#......##....##....##......#",
-                "#.##########.##.##########.#",
-                "#.##########.##.##########.#",
-                "#..........................#",
-                "############################"
-            }};
-
-            width_ = static_cast<int>(LEVEL[0].size());
-            height_ = static_cast<int>(LEVEL.size());
-            tiles_.assign(width_ * height_, TileType::Path);
-            pelletCount_ = 0;
-
-            for (int y = 0; y < height_; ++y) {
-                for (int x = 0; x < width_; ++x) {
-                    char c = (x < static_cast<int>(LEVEL[y].size())) ? LEVEL[y][x] : ' ';
-                    TileType tile = TileType::Path;
-
-                    switch (c) {
-                        case '#': tile = TileType::Wall; break;
-                        case '.': tile = TileType::Pellet; pelletCount_++; break;
-                        case 'o': tile = TileType::PowerPellet; pelletCount_++; break;
-                        case '-': tile = TileType::GhostDoor; break;
-                        case 'G': tile = TileType::Path; break; // Ghost house interior
-                        default:  tile = TileType::Path; break;
-                    }
-                    tiles_[y * width_ + x] = tile;
-                }
-            }
-            initialPelletCount_ = pelletCount_;
+        static constexpr int MaxTiles = Bitboard::BitCount;
+        static constexpr int Width = GameConfig::MapWidth;
+        static constexpr int Height = GameConfig::MapHeight;
+
+        constexpr Map() { Load(DefaultLevel); }
+        constexpr explicit Map(const LevelImage& level) { Load(level); }
+
+        /// @brief Restore the built-in level
+        void Initialize() { Load(DefaultLevel); }
+
+        /// @brief Restore a pristine level image; a straight copy of its layers, no parsing
+        constexpr void Load(const LevelImage& level) {
+            walls_ = level.Walls;
+            doors_ = level.Doors;
+            pellets_ = level.Pellets;
+            powerPellets_ = level.PowerPellets;
+            empty_.Clear();
+            pelletCount_ = level.PelletCount;
+            initialPelletCount_ = level.PelletCount;
         }
 
-        TileType GetTileAt(const Vector2& pos) const {
+        constexpr TileType GetTileAt(const Vector2& pos) const {
             if (!IsInBounds(pos)) return TileType::Wall;
-            return tiles_[pos.Y * width_ + pos.X];
+            int index = pos.Y * Width + pos.X;
+            if (walls_.Test(index)) return TileType::Wall;
+            if (pellets_.Test(index)) return TileType::Pellet;
+            if (powerPellets_.Test(index)) return TileType::PowerPellet;
+            if (doors_.Test(index)) return TileType::GhostDoor;
+            if (empty_.Test(index)) return TileType::Empty;
+            return TileType::Path;
         }
 
         void SetTileAt(const Vector2& pos, TileType type) {
             if (!IsInBounds(pos)) return;
-            TileType old = tiles_[pos.Y * width_ + pos.X];
-            tiles_[pos.Y * width_ + pos.X] = type;
-
-            if ((old == TileType::Pellet || old == TileType::PowerPellet) &&
-                (type != TileType::Pellet && type != TileType::PowerPellet)) {
-                pelletCount_--;
+            int index = pos.Y * Width + pos.X;
+            pelletCount_ -= pellets_.Test(index) + powerPellets_.Test(index);
+            walls_.Reset(index);
+            pellets_.Reset(index);
+            powerPellets_.Reset(index);
+            doors_.Reset(index);
+            empty_.Reset(index);
+
+            switch (type) {
+                case TileType::Wall:        walls_.Set(index); break;
+                case TileType::Pellet:      pellets_.Set(index); ++pelletCount_; break;
+                case TileType::PowerPellet: powerPellets_.Set(index); ++pelletCount_; break;
+                case TileType::GhostDoor:   doors_.Set(index); break;
+                case TileType::Empty:       empty_.Set(index); break;
+                case TileType::Path:        break;
             }
         }
 
-        bool IsInBounds(const Vector2& pos) const {
-            return pos.X >= 0 && pos.Y >= 0 && pos.X < width_ && pos.Y < height_;
+        constexpr bool IsInBounds(const Vector2& pos) const {
+            return pos.X >= 0 && pos.Y >= 0 && pos.X < Width && pos.Y < Height;
         }
 
-        bool IsWalkable(const Vector2& pos) const {
-            TileType tile = GetTileAt(pos);
-            return tile != TileType::Wall && tile != TileType::GhostDoor;
+        constexpr bool IsWalkable(const Vector2& pos) const {
+            if (!IsInBounds(pos)) return false;
+            int index = pos.Y * Width + pos.X;
+            return !walls_.Test(index) && !doors_.Test(index);
         }
 
-        bool IsGhostWalkable(const Vector2& pos, bool canUseGhostDoor = false) const {
-            TileType tile = GetTileAt(pos);
-            if (tile == TileType::Wall) return false;
-            if (tile == TileType::GhostDoor) return canUseGhostDoor;
+        constexpr bool IsGhostWalkable(const Vector2& pos, bool canUseGhostDoor = false) const {
+            if (!IsInBounds(pos)) return false;
+            int index = pos.Y * Width + pos.X;
+            if (walls_.Test(index)) return false;
+            if (doors_.Test(index)) return canUseGhostDoor;
             return true;
         }
 
-        Vector2 WrapPosition(const Vector2& pos) const {
+        constexpr Vector2 WrapPosition(const Vector2& pos) const {
             Vector2 wrapped = pos;
-            if (wrapped.X < 0) wrapped.X = width_ - 1;
-            else if (wrapped.X >= width_) wrapped.X = 0;
+            if (wrapped.X < 0) wrapped.X = Width - 1;
+            else if (wrapped.X >= Width) wrapped.X = 0;
             return wrapped;
         }
 
-        int GetWidth() const { return width_; }
-        int GetHeight() const { return height_; }
-        Vector2 GetSize() const { return {width_, height_}; }
+        int GetWidth() const { return Width; }
+        int GetHeight() const { return Height; }
+        Vector2 GetSize() const { return {Width, Height}; }
         int GetPelletCount() const { return pelletCount_; }
         int GetInitialPelletCount() const { return initialPelletCount_; }
 
+        /// @brief Pellet and power pellet layers; a tile is in at most one of them
+        const Bitboard& GetPellets() const { return pellets_; }
+        const Bitboard& GetPowerPellets() const { return powerPellets_; }
+        const Bitboard& GetWalls() const { return walls_; }
+        const Bitboard& GetDoors() const { return doors_; }
+
+        /// @brief Call fn(position) for every remaining pellet in row-major order, without allocating
+        template<typename Fn>
+        void ForEachPellet(Fn&& fn) const {
+            (pellets_ | powerPellets_).ForEachSetBit([&](int index) {
+                fn(Vector2{index % Width, index / Width});
+            });
+        }
+
         std::vector<Vector2> GetPelletPositions() const {
             std::vector<Vector2> positions;
-            positions.reserve(pelletCount_);
-
-            for (int y = 0; y < height_; ++y) {
-                for (int x = 0; x < width_; ++x) {
-                    TileType tile = GetTileAt({x, y});
-                    if (tile == TileType::Pellet || tile == TileType::PowerPellet) {
-                        positions.push_back({x, y});
-                    }
-                }
-            }
+            positions.reserve(GetPelletCount());
+            ForEachPellet([&](const Vector2& pos) { positions.push_back(pos); });
             return positions;
         }
 
     private:
-        int width_ = 0;
-        int height_ = 0;
-        std::vector<TileType> tiles_;
+        Bitboard walls_;
+        Bitboard doors_;
+        Bitboard pellets_;
+        Bitboard powerPellets_;
+        // Tiles explicitly set to TileType::Empty; anything in no layer is a plain Path
+        Bitboard empty_;
+        // Popcount of the pellet layers, kept up to date by SetTileAt so per-tick checks are free
         int pelletCount_ = 0;
         int initialPelletCount_ = 0;
     };
 
-}
\ No newline at end of file
+}
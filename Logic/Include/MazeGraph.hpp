@@ -0,0 +1,98 @@
+#pragma once
+
+#include "GameTypes.hpp"
+#include "GameConfig.hpp"
+#include "Map.hpp"
+#include <array>
+#include <cstdint>
+
+namespace Pacman {
+
+    /// @brief Movement tables precomputed from a Map's walls and ghost door
+    ///
+    /// Every tile gets a 4-bit exit mask (one bit per Direction) for the
+    /// player, for ghosts and for eaten ghosts returning home, plus the index
+    /// of its neighbor in each direction with the side tunnel already wrapped.
+    /// Only walls and doors are read, so eating pellets never invalidates it.
+    class MazeGraph {
+    public:
+        static constexpr int Width = GameConfig::MapWidth;
+        static constexpr int Height = GameConfig::MapHeight;
+        static constexpr int TileCount = Width * Height;
+
+        /// @brief Which movement rules to apply
+        enum class Mover : uint8_t {
+            Player,
+            Ghost,
+            EatenGhost
+        };
+
+        struct Node {
+            std::array<int16_t, 4> Neighbors{};
+            uint8_t PlayerExits = 0;
+            // Door is open only in and around the ghost house
+            uint8_t GhostExits = 0;
+            // Door is always open while an eaten ghost heads home
+            uint8_t EatenExits = 0;
+        };
+
+        /// @brief Inclusive tile rectangle in which ghosts may pass through the door
+        struct HouseArea {
+            Vector2 Min;
+            Vector2 Max;
+
+            constexpr bool Contains(const Vector2& pos) const {
+                return pos.X >= Min.X && pos.X <= Max.X && pos.Y >= Min.Y && pos.Y <= Max.Y;
+            }
+        };
+
+        static constexpr HouseArea DefaultHouseArea = {{10, 12}, {17, 16}};
+
+        constexpr explicit MazeGraph(const Map& map, const HouseArea& houseArea = DefaultHouseArea) {
+            for (int tile = 0; tile < TileCount; ++tile) {
+                Vector2 pos = ToPosition(tile);
+                bool canUseGhostDoor = houseArea.Contains(pos);
+                Node& node = nodes_[tile];
+
+                for (Direction dir : {Direction::Up, Direction::Down, Direction::Left, Direction::Right}) {
+                    Vector2 next = map.WrapPosition(pos + GetDirectionDelta(dir));
+                    node.Neighbors[static_cast<int>(dir)] =
+                        static_cast<int16_t>(map.IsInBounds(next) ? ToIndex(next) : tile);
+
+                    if (map.IsWalkable(next)) node.PlayerExits |= ExitBit(dir);
+                    if (map.IsGhostWalkable(next, canUseGhostDoor)) node.GhostExits |= ExitBit(dir);
+                    if (map.IsGhostWalkable(next, true)) node.EatenExits |= ExitBit(dir);
+                }
+            }
+        }
+
+        const Node& GetNode(int tile) const { return nodes_[tile]; }
+
+        uint8_t GetPlayerExits(int tile) const { return nodes_[tile].PlayerExits; }
+        uint8_t GetGhostExits(int tile) const { return nodes_[tile].GhostExits; }
+        uint8_t GetEatenExits(int tile) const { return nodes_[tile].EatenExits; }
+
+        uint8_t GetExits(int tile, Mover mover) const {
+            switch (mover) {
+                case Mover::Player: return nodes_[tile].PlayerExits;
+                case Mover::Ghost:  return nodes_[tile].GhostExits;
+                default:            return nodes_[tile].EatenExits;
+            }
+        }
+
+        int GetNeighbor(int tile, Direction dir) const {
+            return nodes_[tile].Neighbors[static_cast<int>(dir)];
+        }
+
+        static constexpr uint8_t ExitBit(Direction dir) {
+            return static_cast<uint8_t>(1u << static_cast<int>(dir));
+        }
+
+        static constexpr int ToIndex(const Vector2& pos) { return pos.Y * Width + pos.X; }
+        static constexpr Vector2 ToPosition(int tile) { return {tile % Width, tile / Width}; }
+
+    private:
+        std::array<Node, TileCount> nodes_{};
+    };
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Pacman {
+
+    /// @brief Small PCG32 random generator
+    ///
+    /// Eight bytes of state, so it can live inside per-game arrays and be
+    /// copied along with the rest of the simulation state.
+    class Random {
+    public:
+        Random() { Seed(0); }
+        explicit Random(uint64_t seed) { Seed(seed); }
+
+        void Seed(uint64_t seed) {
+            state_ = 0;
+            NextUInt32();
+            state_ += seed;
+            NextUInt32();
+        }
+
+        uint32_t NextUInt32() {
+            uint64_t old = state_;
+            state_ = old * Multiplier + Increment;
+            uint32_t xorShifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+            uint32_t rot = static_cast<uint32_t>(old >> 59u);
+            return (xorShifted >> rot) | (xorShifted << ((32u - rot) & 31u));
+        }
+
+        /// @brief Integer in [0, bound); bias is negligible for the small bounds used here
+        int NextInt(uint32_t bound) {
+            return static_cast<int>(NextUInt32() % bound);
+        }
+
+        bool operator==(const Random& other) const = default;
+
+        /// @brief Raw generator state, for serializing snapshots
+        uint64_t GetState() const { return state_; }
+        void SetState(uint64_t state) { state_ = state; }
+
+    private:
+        static constexpr uint64_t Multiplier = 6364136223846793005ull;
+        static constexpr uint64_t Increment = 1442695040888963407ull;
+
+        uint64_t state_ = 0;
+    };
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "InputLog.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Pacman {
+
+    /// @brief Full state at one tick, in the compact form of EncodeCompactSnapshot
+    struct ReplayKeyframe {
+        uint32_t Tick = 0;
+        /// @brief Frame time in effect before the entries of this tick
+        float DeltaTime = 0.0f;
+        std::vector<uint8_t> State;
+    };
+
+    /// @brief One recorded game: everything needed to re-simulate it
+    struct Replay {
+        uint64_t Seed = 0;
+        uint32_t LevelIndex = 0;
+        /// @brief Input log entries after GameStarted, in tick order, without GameEnded
+        std::vector<InputLogEntry> Entries;
+        /// @brief The GameEnded entry; missing if recording stopped before the game ended
+        std::optional<InputLogEntry> End;
+        /// @brief Periodic full states in tick order, for seeking
+        std::vector<ReplayKeyframe> Keyframes;
+    };
+
+    /// @brief Streams input log entries into the compact replay format
+    ///
+    /// A replay file is the 8-byte magic "CSMCRPLY", a varint format version,
+    /// then every logged entry as varint((ticks since previous entry << 3) | code).
+    /// Codes 0-4 are a Direction, 5 is Paused, 6 is Resumed and 7 is followed
+    /// by a subtype byte and its payload: DeltaTime (float bits, little
+    /// endian), GameStarted (seed, level), GameEnded (state, score, lives,
+    /// pellets, position; signed values zigzag-encoded) or Keyframe (float
+    /// bits, then a varint length and a compact snapshot). A direction change
+    /// less than 16 ticks after the previous entry takes one byte. A file
+    /// can hold any number of games back to back.
+    class ReplayEncoder {
+    public:
+        static constexpr char Magic[8] = {'C', 'S', 'M', 'C', 'R', 'P', 'L', 'Y'};
+        static constexpr uint32_t FormatVersion = 2;
+        /// @brief Oldest version DecodeReplays still reads; version 1 had no keyframes
+        static constexpr uint32_t MinFormatVersion = 1;
+
+        /// @brief Append the file header
+        static void EncodeHeader(std::vector<uint8_t>& out);
+
+        /// @brief Append one entry; entries of a game must arrive in tick order
+        void Encode(const InputLogEntry& entry, std::vector<uint8_t>& out);
+
+        /// @brief Append a keyframe that is already in compact form
+        void EncodeKeyframe(const ReplayKeyframe& keyframe, std::vector<uint8_t>& out);
+
+    private:
+        uint64_t AdvanceTo(uint32_t tick);
+
+        uint32_t lastTick_ = 0;
+        std::vector<uint8_t> scratch_;
+    };
+
+    /// @brief Every game in a replay stream, including a final game cut short
+    ///
+    /// Parsing stops quietly at the first malformed or truncated entry, so a
+    /// file whose writer was interrupted still yields the games before it.
+    /// Returns nothing if the header does not match.
+    std::vector<Replay> DecodeReplays(std::span<const uint8_t> data);
+
+    /// @brief Read and decode a replay file; empty if it cannot be read
+    std::vector<Replay> LoadReplays(const std::string& path);
+
+    /// @brief Write games as one replay file; returns false on I/O failure
+    bool SaveReplays(const std::string& path, std::span<const Replay> replays);
+
+}
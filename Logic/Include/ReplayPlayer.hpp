@@ -0,0 +1,79 @@
+#pragma once
+
+#include "EngineSnapshot.hpp"
+#include "IGameEngine.hpp"
+#include "LevelPack.hpp"
+#include "Replay.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Pacman {
+
+    /// @brief Re-simulates a recorded game in its own engine
+    ///
+    /// The engine is created with the recorded seed on the recorded maze and
+    /// fed the logged inputs in the ticks they were applied, so it passes
+    /// through exactly the states of the original game. Tools and the GUI
+    /// can read or render GetEngine() at any tick; do not drive it directly.
+    /// Seeking jumps to the nearest keyframe at or before the target and
+    /// simulates only the ticks after it, so it costs at most one keyframe
+    /// interval of updates wherever the target lies.
+    class ReplayPlayer {
+    public:
+        static constexpr float DefaultDeltaTime = 1.0f / 60.0f;
+
+        /// @param replay Game to play back
+        /// @param pack Pack the replay's level index refers to
+        explicit ReplayPlayer(Replay replay, std::shared_ptr<const LevelPack> pack = LevelPack::BuiltIn());
+
+        /// @brief False if the pack has no level with the recorded index
+        bool IsValid() const { return isValid_; }
+
+        const Replay& GetReplay() const { return replay_; }
+        const IGameEngine& GetEngine() const { return *engine_; }
+
+        /// @brief Ticks played so far
+        uint32_t GetTick() const { return tick_; }
+
+        /// @brief Length of the game: the recorded end, or the tick after the last input if it was cut short
+        uint32_t GetEndTick() const { return endTick_; }
+
+        bool IsFinished() const { return tick_ >= endTick_; }
+
+        /// @brief Play one tick; does nothing once finished
+        void Step();
+
+        /// @brief Back to the state right after StartNewGame
+        void Rewind();
+
+        /// @brief Move to the state after the given number of ticks, clamped to GetEndTick()
+        void SeekTo(uint32_t tick);
+
+        /// @brief Updates run since construction, including those spent seeking
+        uint64_t GetTicksSimulated() const { return ticksSimulated_; }
+
+        /// @brief Play the remaining ticks
+        void RunToEnd() { SeekTo(endTick_); }
+
+        /// @brief True if the replay was recorded to its end and the engine now matches that end
+        bool MatchesRecordedEnd() const;
+
+    private:
+        /// @brief Load the keyframe, returning false if it does not decode
+        bool RestoreKeyframe(const ReplayKeyframe& keyframe);
+
+        Replay replay_;
+        std::shared_ptr<const LevelPack> pack_;
+        std::shared_ptr<IGameEngine> engine_;
+        const LevelData* level_ = nullptr;
+        EngineSnapshot keyframeState_;
+        bool isValid_ = false;
+        uint32_t endTick_ = 0;
+        uint32_t tick_ = 0;
+        std::size_t nextEntry_ = 0;
+        float deltaTime_ = DefaultDeltaTime;
+        uint64_t ticksSimulated_ = 0;
+    };
+
+}
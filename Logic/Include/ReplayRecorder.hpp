@@ -0,0 +1,68 @@
+#pragma once
+
+#include "IEventListener.hpp"
+#include "Replay.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Pacman {
+
+    /// @brief Listener that streams an engine's input log to a replay file
+    ///
+    /// Entries are encoded in memory on the engine's thread; a background
+    /// thread does all file I/O, so Update never waits on the disk. The
+    /// engine thread only takes a short lock to hand over a filled buffer,
+    /// which happens every FlushThreshold bytes and at the end of each game.
+    /// Every game started while attached is recorded, back to back.
+    class ReplayRecorder : public IEventListener {
+    public:
+        static constexpr std::size_t FlushThreshold = 4096;
+
+        explicit ReplayRecorder(const std::string& path);
+
+        /// @brief Hands over whatever is buffered and waits for the writer to finish
+        ~ReplayRecorder() override;
+
+        ReplayRecorder(const ReplayRecorder&) = delete;
+        ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+
+        /// @brief False if the file could not be created; nothing is recorded then
+        bool IsOpen() const { return isOpen_; }
+
+        /// @brief Hand buffered entries to the writer without waiting for them to be written
+        ///
+        /// Call it from the thread that drives the engine, like the callbacks.
+        void Flush();
+
+        void OnTileUpdated(const TileUpdate&) override {}
+        void OnPlayerStateChanged(const PlayerState&) override {}
+        void OnGameStateChanged(GameState) override {}
+        void OnGhostsUpdated(std::span<const GhostState>) override {}
+        void OnInputLogged(const InputLogEntry& entry) override;
+
+    private:
+        void WriterLoop();
+
+        std::ofstream file_;
+        bool isOpen_ = false;
+
+        // Engine thread only
+        ReplayEncoder encoder_;
+        std::vector<uint8_t> buffer_;
+
+        // Shared with the writer thread
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::vector<uint8_t> outgoing_;
+        bool stopping_ = false;
+
+        std::thread writer_;
+    };
+
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#if defined(COSMIC_TICK_PROFILER) && (defined(__x86_64__) || defined(_M_X64))
+#define COSMIC_TICK_PROFILER_RDTSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace Pacman {
+
+    /// @brief Parts of GameEngine::Update that are timed separately
+    ///
+    /// Notification covers every listener and frame listener callback. It
+    /// also counts toward the phase that sent it, and every phase counts
+    /// toward Update.
+    enum class TickPhase : uint8_t {
+        Update,
+        ModeController,
+        Player,
+        Ghosts,
+        Collisions,
+        Notification,
+        Count
+    };
+
+    inline constexpr std::array<const char*, static_cast<std::size_t>(TickPhase::Count)> TickPhaseNames = {
+        "Update", "ModeController", "Player", "Ghosts", "Collisions", "Notification"
+    };
+
+    /// @brief Log-linear histogram of durations in the style of HdrHistogram
+    ///
+    /// Values below 32 get a bucket each; above that, every power of two is
+    /// split into 16 buckets, so a recorded value is off by at most 1/16 of
+    /// itself and the whole uint64_t range fits in under a thousand counters.
+    class LatencyHistogram {
+    public:
+        static constexpr int SubBucketBits = 5;
+        static constexpr uint64_t SubBucketCount = uint64_t{1} << SubBucketBits;
+        static constexpr uint64_t HalfCount = SubBucketCount / 2;
+        static constexpr std::size_t BucketCount = SubBucketCount + (64 - SubBucketBits) * HalfCount;
+
+        static constexpr std::size_t BucketOf(uint64_t value) {
+            if (value < SubBucketCount) return static_cast<std::size_t>(value);
+            int shift = std::bit_width(value) - SubBucketBits;
+            return static_cast<std::size_t>(SubBucketCount + (shift - 1) * HalfCount + ((value >> shift) - HalfCount));
+        }
+
+        /// @brief Smallest value that lands in the bucket
+        static constexpr uint64_t LowestValueOf(std::size_t bucket) {
+            if (bucket < SubBucketCount) return bucket;
+            uint64_t offset = bucket - SubBucketCount;
+            int shift = static_cast<int>(offset / HalfCount) + 1;
+            return (offset % HalfCount + HalfCount) << shift;
+        }
+
+        /// @brief Largest value that lands in the bucket
+        static constexpr uint64_t HighestValueOf(std::size_t bucket) {
+            return bucket + 1 < BucketCount ? LowestValueOf(bucket + 1) - 1 : UINT64_MAX;
+        }
+
+        void Add(uint64_t value, uint64_t count = 1);
+        /// @brief Add values already sorted into buckets, given their exact sum, min and max
+        void AddBuckets(const std::array<uint64_t, BucketCount>& counts, uint64_t sum, uint64_t min, uint64_t max);
+        void Merge(const LatencyHistogram& other);
+        void Clear() { *this = LatencyHistogram(); }
+
+        uint64_t GetCount() const { return count_; }
+        uint64_t GetSum() const { return sum_; }
+        uint64_t GetMin() const { return count_ ? min_ : 0; }
+        uint64_t GetMax() const { return max_; }
+        double GetMean() const { return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0; }
+
+        /// @brief Upper end of the bucket holding the given percentile (0-100), capped at GetMax()
+        uint64_t GetValueAtPercentile(double percentile) const;
+
+        uint64_t GetBucket(std::size_t bucket) const { return buckets_[bucket]; }
+
+    private:
+        std::array<uint64_t, BucketCount> buckets_{};
+        uint64_t count_ = 0;
+        uint64_t sum_ = 0;
+        uint64_t min_ = UINT64_MAX;
+        uint64_t max_ = 0;
+    };
+
+    /// @brief Process-wide per-phase timings of GameEngine::Update
+    ///
+    /// Only collects anything when the library is built with
+    /// COSMIC_TICK_PROFILER (CMake option ENABLE_TICK_PROFILER); otherwise
+    /// the scopes in the engine compile to nothing and every query returns
+    /// empty histograms. Each thread records into its own histograms without
+    /// locking, so batch workers do not contend; queries merge all threads.
+    /// When a thread exits its timings are folded into a shared total and
+    /// its histograms are freed. When enabled, a report is written to stderr
+    /// at exit if anything was recorded. Count, mean, min and max are exact;
+    /// percentiles are accurate to the histogram buckets.
+    class TickProfiler {
+    public:
+        using Histograms = std::array<LatencyHistogram, static_cast<std::size_t>(TickPhase::Count)>;
+
+        static constexpr bool IsEnabled() {
+#if defined(COSMIC_TICK_PROFILER)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /// @brief Raw time stamp: TSC cycles on x86-64, steady clock nanoseconds elsewhere
+        static uint64_t Now() {
+#if defined(COSMIC_TICK_PROFILER_RDTSC)
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        /// @brief Add one duration, in Now() units, to the calling thread's histogram
+        static void Record(TickPhase phase, uint64_t duration);
+
+        /// @brief Merged histograms of every thread, in Now() units
+        static Histograms Collect();
+
+        /// @brief Now() units per nanosecond, measured against the steady clock since the first Record
+        static double GetTicksPerNanosecond();
+
+        /// @brief Drop everything recorded so far
+        static void Reset();
+
+        /// @brief Count, mean and percentiles of every phase in nanoseconds
+        static void Dump(std::ostream& out);
+    };
+
+    /// @brief Times its own lifetime into one phase
+    class TickProfileScope {
+    public:
+        explicit TickProfileScope(TickPhase phase) : phase_(phase), start_(TickProfiler::Now()) {}
+        ~TickProfileScope() { TickProfiler::Record(phase_, TickProfiler::Now() - start_); }
+
+        TickProfileScope(const TickProfileScope&) = delete;
+        TickProfileScope& operator=(const TickProfileScope&) = delete;
+
+    private:
+        TickPhase phase_;
+        uint64_t start_;
+    };
+
+}
+
+#if defined(COSMIC_TICK_PROFILER)
+#define COSMIC_PROFILE_CONCAT_(a, b) a##b
+#define COSMIC_PROFILE_CONCAT(a, b) COSMIC_PROFILE_CONCAT_(a, b)
+/// @brief Time the rest of the enclosing block as the given TickPhase
+#define COSMIC_PROFILE_SCOPE(phase) \
+    ::Pacman::TickProfileScope COSMIC_PROFILE_CONCAT(cosmicProfileScope, __LINE__)(::Pacman::TickPhase::phase)
+#else
+#define COSMIC_PROFILE_SCOPE(phase) static_cast<void>(0)
+#endif
@@ -0,0 +1,603 @@
+#include "BatchEnvironment.hpp"
+#include "Level.hpp"
+#include "Map.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstdlib>
+#include <limits>
+
+namespace Pacman {
+
+    namespace {
+
+        struct GhostSpawn {
+            int X;
+            int Y;
+            Direction StartDirection;
+            GhostType Type;
+            Vector2 ScatterTarget;
+        };
+
+        constexpr std::array<GhostSpawn, BatchEnvironment::GhostCount> GhostSpawns = {{
+            {13, 11, Direction::Left, GhostType::Red,
+             {GameConfig::RedScatterX, GameConfig::RedScatterY}},
+            {13, 14, Direction::Down, GhostType::Pink,
+             {GameConfig::PinkScatterX, GameConfig::PinkScatterY}},
+            {11, 14, Direction::Up, GhostType::Blue,
+             {GameConfig::BlueScatterX, GameConfig::BlueScatterY}},
+            {15, 14, Direction::Up, GhostType::Orange,
+             {GameConfig::OrangeScatterX, GameConfig::OrangeScatterY}}
+        }};
+
+        constexpr std::array<Direction, 4> GhostPriorities = {
+            Direction::Up, Direction::Left, Direction::Down, Direction::Right
+        };
+
+        /// @brief Add each game's tick time to its clocks and flag the games that need a visit
+        ///
+        /// A game is due when a player or ghost step or a mode change falls in
+        /// this tick. Stopped clocks get zero added, which leaves them as
+        /// GameEngine's conditional updates would. Written without branches
+        /// over non-aliasing columns so the compiler vectorizes it.
+        void AdvanceClocks(std::size_t count, const float* __restrict tickTime,
+                           const float* __restrict frightenedTickTime, float* __restrict playerTimer,
+                           float* __restrict ghostTimer, float* __restrict waveTimer,
+                           float* __restrict frightenedTimer, const float* __restrict ghostInterval,
+                           const float* __restrict phaseDuration, uint8_t* __restrict due) {
+            for (std::size_t game = 0; game < count; ++game) {
+                float elapsed = tickTime[game];
+                float frightenedElapsed = frightenedTickTime[game];
+                float player = playerTimer[game] + elapsed;
+                float ghost = ghostTimer[game] + elapsed;
+                // The wave clock is paused while frightened, and never due then
+                float wave = waveTimer[game] + (elapsed - frightenedElapsed);
+                float frightened = frightenedTimer[game] - frightenedElapsed;
+                playerTimer[game] = player;
+                ghostTimer[game] = ghost;
+                waveTimer[game] = wave;
+                frightenedTimer[game] = frightened;
+
+                bool modeChange = ((frightenedElapsed > 0.0f) & (frightened <= 0.0f)) | (wave >= phaseDuration[game]);
+                bool stepDue = (player >= GameConfig::PlayerStepInterval) | (ghost >= ghostInterval[game]);
+                due[game] = (elapsed > 0.0f) & (modeChange | stepDue);
+            }
+        }
+
+        /// @brief Length of a scatter or chase phase, as GhostModeController times it
+        float GetPhaseDuration(int wave, bool scatter) {
+            if (wave >= GameConfig::ScatterChaseWaves) return std::numeric_limits<float>::infinity();
+            return scatter ? GameConfig::ScatterDurations[wave] : GameConfig::ChaseDurations[wave];
+        }
+
+    }
+
+    BatchEnvironment::BatchEnvironment(std::size_t gameCount, uint64_t seed, float deltaTime)
+        : gameCount_(gameCount), seed_(seed), deltaTime_(deltaTime), graph_(Map(DefaultLevel)) {
+        Map map;
+        for (int y = 0; y < Height; ++y) {
+            for (int x = 0; x < Width; ++x) {
+                uint8_t flags = 0;
+                switch (map.GetTileAt({x, y})) {
+                    case TileType::Wall:        flags = WallFlag; break;
+                    case TileType::GhostDoor:   flags = DoorFlag; break;
+                    case TileType::Pellet:      flags = PelletFlag; break;
+                    case TileType::PowerPellet: flags = PelletFlag | PowerPelletFlag; break;
+                    default:                    break;
+                }
+                layout_[y * Width + x] = flags;
+            }
+        }
+        initialPellets_ = map.GetPellets() | map.GetPowerPellets();
+        initialPelletCount_ = map.GetInitialPelletCount();
+
+        gameState_.resize(gameCount_);
+        playerX_.resize(gameCount_);
+        playerY_.resize(gameCount_);
+        playerDirection_.resize(gameCount_);
+        desiredDirection_.resize(gameCount_);
+        poweredUp_.resize(gameCount_);
+        score_.resize(gameCount_);
+        lives_.resize(gameCount_);
+        pelletCount_.resize(gameCount_);
+        pellets_.resize(gameCount_);
+        playerStepTimer_.resize(gameCount_);
+        ghostStepTimer_.resize(gameCount_);
+        ghostInterval_.resize(gameCount_);
+        tickTime_.resize(gameCount_);
+        frightenedTickTime_.resize(gameCount_);
+        wave_.resize(gameCount_);
+        scatter_.resize(gameCount_);
+        frightened_.resize(gameCount_);
+        waveTimer_.resize(gameCount_);
+        phaseDuration_.resize(gameCount_);
+        frightenedTimer_.resize(gameCount_);
+        rng_.resize(gameCount_);
+
+        ghostX_.resize(gameCount_ * GhostCount);
+        ghostY_.resize(gameCount_ * GhostCount);
+        ghostTargetX_.resize(gameCount_ * GhostCount);
+        ghostTargetY_.resize(gameCount_ * GhostCount);
+        ghostDirection_.resize(gameCount_ * GhostCount);
+        ghostMode_.resize(gameCount_ * GhostCount);
+        ghostFrightened_.resize(gameCount_ * GhostCount);
+        ghostEaten_.resize(gameCount_ * GhostCount);
+
+        due_.resize(gameCount_);
+        dueGames_.resize(gameCount_);
+        ghostGames_.reserve(gameCount_);
+        for (KernelLanes& lanes : lanes_) {
+            for (auto* column : {&lanes.GhostX, &lanes.GhostY, &lanes.Exits, &lanes.Chase,
+                                 &lanes.PlayerX, &lanes.PlayerY, &lanes.PlayerDirection,
+                                 &lanes.BlinkyX, &lanes.BlinkyY,
+                                 &lanes.TargetX, &lanes.TargetY, &lanes.NewDirection}) {
+                column->resize(gameCount_);
+            }
+        }
+
+        Reset();
+    }
+
+    void BatchEnvironment::Reset() {
+        for (std::size_t game = 0; game < gameCount_; ++game) {
+            ResetGame(game);
+        }
+    }
+
+    void BatchEnvironment::ResetGame(std::size_t game) {
+        // Reseeded like GameEngine::StartNewGame, so every game replays its fresh engine
+        rng_[game].Seed(seed_ + game);
+        gameState_[game] = static_cast<uint8_t>(GameState::Running);
+        pellets_[game] = initialPellets_;
+        pelletCount_[game] = static_cast<int16_t>(initialPelletCount_);
+
+        InitializePlayer(game);
+        score_[game] = 0;
+        lives_[game] = GameConfig::StartingLives;
+        InitializeGhosts(game);
+        ResetModes(game);
+        playerStepTimer_[game] = 0.0f;
+        ghostStepTimer_[game] = 0.0f;
+    }
+
+    void BatchEnvironment::Step(std::span<const Direction> actions) {
+        assert(actions.size() == gameCount_);
+
+        // Most ticks only move timers, so they advance for every game in one vectorized pass
+        AdvanceClocks(gameCount_, tickTime_.data(), frightenedTickTime_.data(), playerStepTimer_.data(),
+                      ghostStepTimer_.data(), waveTimer_.data(), frightenedTimer_.data(),
+                      ghostInterval_.data(), phaseDuration_.data(), due_.data());
+
+        // Only the games with a mode change or a step due this tick are visited again
+        std::size_t dueCount = 0;
+        for (std::size_t game = 0; game < gameCount_; ++game) {
+            dueGames_[dueCount] = static_cast<uint32_t>(game);
+            dueCount += due_[game];
+        }
+        std::span<const uint32_t> dueGames(dueGames_.data(), dueCount);
+
+        // Players first, as in GameEngine::Update, so ghosts target the new positions
+        ghostGames_.clear();
+        for (uint32_t game : dueGames) {
+            desiredDirection_[game] = actions[game];
+            AdvanceModes(game);
+            StepPlayer(game);
+            // Pellets and frightened mode set the ghost speed, and only change above
+            ghostInterval_[game] = GetGhostInterval(game);
+            if (ghostStepTimer_[game] >= ghostInterval_[game]) {
+                ghostGames_.push_back(game);
+            }
+        }
+
+        // Ghost steps of all games go through the kernel together; a game that
+        // owes more than one step stays in the list for another round
+        while (!ghostGames_.empty()) {
+            StepGhosts();
+            std::size_t kept = 0;
+            for (uint32_t game : ghostGames_) {
+                ghostStepTimer_[game] -= ghostInterval_[game];
+                if (ghostStepTimer_[game] >= ghostInterval_[game]) {
+                    ghostGames_[kept++] = game;
+                }
+            }
+            ghostGames_.resize(kept);
+        }
+
+        // Positions and pellets, and therefore collisions and the win
+        // condition, can only change in a game that was visited
+        for (uint32_t game : dueGames) {
+            CheckCollisions(game);
+            if (pelletCount_[game] == 0) {
+                gameState_[game] = static_cast<uint8_t>(GameState::Victory);
+                UpdateTickTimes(game);
+            }
+        }
+    }
+
+    void BatchEnvironment::SetSimdLevel(SimdLevel level) {
+        simdLevel_ = std::min(level, DetectSimdLevel());
+    }
+
+    std::size_t BatchEnvironment::GetRunningCount() const {
+        std::size_t running = 0;
+        for (uint8_t state : gameState_) {
+            if (state == static_cast<uint8_t>(GameState::Running)) running++;
+        }
+        return running;
+    }
+
+    TileType BatchEnvironment::GetTileAt(std::size_t game, const Vector2& position) const {
+        uint8_t flags = FlagsAt(position.X, position.Y);
+        if (flags & WallFlag) return TileType::Wall;
+        if (flags & DoorFlag) return TileType::GhostDoor;
+
+        int index = position.Y * Width + position.X;
+        if ((flags & PelletFlag) && IsPelletAt(game, index)) {
+            return (flags & PowerPelletFlag) ? TileType::PowerPellet : TileType::Pellet;
+        }
+        return TileType::Path;
+    }
+
+    PlayerState BatchEnvironment::GetPlayerState(std::size_t game) const {
+        PlayerState state;
+        state.Position = GetPlayerPosition(game);
+        state.CurrentDirection = playerDirection_[game];
+        state.Score = score_[game];
+        state.IsPoweredUp = poweredUp_[game] != 0;
+        state.Lives = lives_[game];
+        return state;
+    }
+
+    std::array<GhostState, BatchEnvironment::GhostCount> BatchEnvironment::GetGhostStates(std::size_t game) const {
+        std::array<GhostState, GhostCount> states;
+        for (std::size_t ghost = 0; ghost < GhostCount; ++ghost) {
+            std::size_t g = game * GhostCount + ghost;
+            GhostState& state = states[ghost];
+            state.Position = {ghostX_[g], ghostY_[g]};
+            state.CurrentDirection = ghostDirection_[g];
+            state.IsFrightened = ghostFrightened_[g] != 0;
+            state.IsEaten = ghostEaten_[g] != 0;
+            state.Type = GhostSpawns[ghost].Type;
+            state.Mode = ghostMode_[g];
+            state.TargetTile = {ghostTargetX_[g], ghostTargetY_[g]};
+            state.ScatterTarget = GhostSpawns[ghost].ScatterTarget;
+        }
+        return states;
+    }
+
+    void BatchEnvironment::AdvanceModes(std::size_t game) {
+        // Same transitions as GhostModeController::Update, whose timers Step already advanced
+        if (frightened_[game]) {
+            if (frightenedTimer_[game] > 0.0f) return;
+            frightened_[game] = 0;
+            frightenedTimer_[game] = 0.0f;
+            UpdateTickTimes(game);
+            for (std::size_t g = game * GhostCount; g < (game + 1) * GhostCount; ++g) {
+                ghostFrightened_[g] = 0;
+            }
+            return;
+        }
+
+        if (waveTimer_[game] < phaseDuration_[game]) return;
+        waveTimer_[game] -= phaseDuration_[game];
+        if (scatter_[game]) {
+            scatter_[game] = 0;
+        } else {
+            wave_[game]++;
+            scatter_[game] = wave_[game] < GameConfig::ScatterChaseWaves;
+        }
+        phaseDuration_[game] = GetPhaseDuration(wave_[game], scatter_[game]);
+
+        for (std::size_t g = game * GhostCount; g < (game + 1) * GhostCount; ++g) {
+            if (!ghostEaten_[g]) {
+                ghostDirection_[g] = GetOppositeDirection(ghostDirection_[g]);
+            }
+        }
+    }
+
+    void BatchEnvironment::ResetModes(std::size_t game) {
+        wave_[game] = 0;
+        scatter_[game] = 1;
+        frightened_[game] = 0;
+        waveTimer_[game] = 0.0f;
+        phaseDuration_[game] = GetPhaseDuration(0, true);
+        frightenedTimer_[game] = 0.0f;
+        ghostInterval_[game] = GetGhostInterval(game);
+        UpdateTickTimes(game);
+    }
+
+    void BatchEnvironment::UpdateTickTimes(std::size_t game) {
+        bool running = gameState_[game] == static_cast<uint8_t>(GameState::Running);
+        tickTime_[game] = running ? deltaTime_ : 0.0f;
+        frightenedTickTime_[game] = frightened_[game] ? tickTime_[game] : 0.0f;
+    }
+
+    GhostMode BatchEnvironment::GetMode(std::size_t game) const {
+        if (frightened_[game]) return GhostMode::Frightened;
+        return scatter_[game] ? GhostMode::Scatter : GhostMode::Chase;
+    }
+
+    void BatchEnvironment::StepPlayer(std::size_t game) {
+        while (playerStepTimer_[game] >= GameConfig::PlayerStepInterval) {
+            UpdatePlayer(game);
+            playerStepTimer_[game] -= GameConfig::PlayerStepInterval;
+        }
+    }
+
+    void BatchEnvironment::UpdatePlayer(std::size_t game) {
+        int tile = playerY_[game] * Width + playerX_[game];
+        uint8_t exits = graph_.GetPlayerExits(tile);
+
+        Direction desired = desiredDirection_[game];
+        if (desired != Direction::None && (exits & MazeGraph::ExitBit(desired))) {
+            playerDirection_[game] = desired;
+        }
+
+        Direction current = playerDirection_[game];
+        if (current != Direction::None && (exits & MazeGraph::ExitBit(current))) {
+            int next = graph_.GetNeighbor(tile, current);
+            playerX_[game] = static_cast<int8_t>(next % Width);
+            playerY_[game] = static_cast<int8_t>(next / Width);
+            ConsumeTile(game, next);
+            poweredUp_[game] = frightened_[game];
+        }
+    }
+
+    void BatchEnvironment::ConsumeTile(std::size_t game, int index) {
+        uint8_t flags = layout_[index];
+        if (!(flags & PelletFlag) || !IsPelletAt(game, index)) return;
+
+        pellets_[game].Reset(index);
+        pelletCount_[game]--;
+
+        if (!(flags & PowerPelletFlag)) {
+            score_[game] += GameConfig::PelletScore;
+            return;
+        }
+
+        score_[game] += GameConfig::PowerPelletScore;
+        frightened_[game] = 1;
+        frightenedTimer_[game] = GameConfig::PowerUpDuration;
+        UpdateTickTimes(game);
+        poweredUp_[game] = 1;
+
+        for (std::size_t g = game * GhostCount; g < (game + 1) * GhostCount; ++g) {
+            if (!ghostEaten_[g]) {
+                ghostFrightened_[g] = 1;
+                ghostDirection_[g] = GetOppositeDirection(ghostDirection_[g]);
+            }
+        }
+    }
+
+    void BatchEnvironment::StepGhosts() {
+        // Ghosts that are neither eaten nor frightened become kernel lanes,
+        // grouped by ghost type so each batch applies a single rule
+        std::array<std::size_t, GhostCount> laneCount{};
+        for (uint32_t game : ghostGames_) {
+            std::size_t first = game * GhostCount;
+            int16_t chase = GetMode(game) != GhostMode::Scatter;
+
+            for (std::size_t ghost = 0; ghost < GhostCount; ++ghost) {
+                std::size_t g = first + ghost;
+                // Every ghost is written to the next free lane, which only
+                // counts as taken for kernel ghosts; cheaper than a branch
+                // that goes either way at random
+                KernelLanes& lanes = lanes_[ghost];
+                std::size_t i = laneCount[ghost];
+                laneCount[ghost] += !(ghostEaten_[g] | ghostFrightened_[g]);
+                int tile = ghostY_[g] * Width + ghostX_[g];
+                lanes.GhostX[i] = ghostX_[g];
+                lanes.GhostY[i] = ghostY_[g];
+                lanes.Exits[i] = graph_.GetGhostExits(tile) &
+                                 ~MazeGraph::ExitBit(GetOppositeDirection(ghostDirection_[g]));
+                lanes.Chase[i] = chase;
+                lanes.PlayerX[i] = playerX_[game];
+                lanes.PlayerY[i] = playerY_[game];
+                lanes.PlayerDirection[i] = static_cast<int16_t>(playerDirection_[game]);
+                lanes.BlinkyX[i] = ghostX_[first];
+                lanes.BlinkyY[i] = ghostY_[first];
+            }
+        }
+
+        for (std::size_t ghost = 0; ghost < GhostCount; ++ghost) {
+            KernelLanes& lanes = lanes_[ghost];
+            GhostKernelBatch batch;
+            batch.Type = GhostSpawns[ghost].Type;
+            batch.ScatterTarget = GhostSpawns[ghost].ScatterTarget;
+            batch.Count = laneCount[ghost];
+            batch.GhostX = lanes.GhostX.data();
+            batch.GhostY = lanes.GhostY.data();
+            batch.Exits = lanes.Exits.data();
+            batch.Chase = lanes.Chase.data();
+            batch.PlayerX = lanes.PlayerX.data();
+            batch.PlayerY = lanes.PlayerY.data();
+            batch.PlayerDirection = lanes.PlayerDirection.data();
+            batch.BlinkyX = lanes.BlinkyX.data();
+            batch.BlinkyY = lanes.BlinkyY.data();
+            batch.TargetX = lanes.TargetX.data();
+            batch.TargetY = lanes.TargetY.data();
+            batch.NewDirection = lanes.NewDirection.data();
+            RunGhostKernel(batch, simdLevel_);
+        }
+
+        // Apply in GameEngine's ghost order so frightened ghosts draw from each
+        // game's generator in the same sequence
+        std::array<std::size_t, GhostCount> lane{};
+        for (uint32_t game : ghostGames_) {
+            bool chase = GetMode(game) != GhostMode::Scatter;
+
+            for (std::size_t ghost = 0; ghost < GhostCount; ++ghost) {
+                std::size_t g = game * GhostCount + ghost;
+
+                if (ghostEaten_[g]) {
+                    UpdateEatenGhost(game, ghost);
+                    continue;
+                }
+
+                Direction newDir;
+                if (ghostFrightened_[g]) {
+                    ghostTargetX_[g] = ghostX_[g];
+                    ghostTargetY_[g] = ghostY_[g];
+                    ghostMode_[g] = GhostMode::Frightened;
+                    newDir = ChooseFrightenedDirection(game, ghost);
+                } else {
+                    const KernelLanes& lanes = lanes_[ghost];
+                    std::size_t i = lane[ghost]++;
+                    ghostTargetX_[g] = static_cast<int8_t>(lanes.TargetX[i]);
+                    ghostTargetY_[g] = static_cast<int8_t>(lanes.TargetY[i]);
+                    ghostMode_[g] = chase ? GhostMode::Chase : GhostMode::Scatter;
+                    newDir = static_cast<Direction>(lanes.NewDirection[i]);
+                }
+
+                if (newDir != Direction::None) {
+                    ghostDirection_[g] = newDir;
+                }
+
+                Direction current = ghostDirection_[g];
+                if (current != Direction::None) {
+                    int tile = ghostY_[g] * Width + ghostX_[g];
+                    if (graph_.GetGhostExits(tile) & MazeGraph::ExitBit(current)) {
+                        MoveGhost(g, graph_.GetNeighbor(tile, current));
+                    }
+                }
+            }
+        }
+    }
+
+    Direction BatchEnvironment::ChooseFrightenedDirection(std::size_t game, std::size_t ghost) {
+        std::size_t g = game * GhostCount + ghost;
+        int tile = ghostY_[g] * Width + ghostX_[g];
+        uint8_t exits = graph_.GetGhostExits(tile) & ~MazeGraph::ExitBit(GetOppositeDirection(ghostDirection_[g]));
+
+        Direction bestDir = Direction::None;
+        for (Direction dir : GhostPriorities) {
+            if (!(exits & MazeGraph::ExitBit(dir))) continue;
+            if (rng_[game].NextInt(4) == 0 || bestDir == Direction::None) {
+                bestDir = dir;
+            }
+        }
+        return bestDir;
+    }
+
+    void BatchEnvironment::UpdateEatenGhost(std::size_t game, std::size_t ghost) {
+        std::size_t g = game * GhostCount + ghost;
+        int x = ghostX_[g];
+        int y = ghostY_[g];
+
+        if (y >= GameConfig::GhostHouseDoorY && std::abs(x - GameConfig::GhostHouseX) <= 2) {
+            ghostEaten_[g] = 0;
+            ghostFrightened_[g] = frightened_[game];
+            ghostX_[g] = GameConfig::GhostHouseX;
+            ghostY_[g] = GameConfig::GhostHouseY;
+            return;
+        }
+
+        int tile = y * Width + x;
+        uint8_t exits = graph_.GetEatenExits(tile);
+        Direction opposite = GetOppositeDirection(ghostDirection_[g]);
+        Direction bestDir = Direction::None;
+        int bestNext = tile;
+        int bestDistSq = INT_MAX;
+
+        for (Direction dir : GhostPriorities) {
+            if (dir == opposite && bestDir != Direction::None) continue;
+            if (!(exits & MazeGraph::ExitBit(dir))) continue;
+
+            int next = graph_.GetNeighbor(tile, dir);
+            int dx = next % Width - GameConfig::GhostHouseX;
+            int dy = next / Width - GameConfig::GhostHouseDoorY;
+            int distSq = dx * dx + dy * dy;
+            if (distSq < bestDistSq) {
+                bestDistSq = distSq;
+                bestDir = dir;
+                bestNext = next;
+            }
+        }
+
+        if (bestDir != Direction::None) {
+            ghostDirection_[g] = bestDir;
+            MoveGhost(g, bestNext);
+        }
+    }
+
+    void BatchEnvironment::CheckCollisions(std::size_t game) {
+        int playerX = playerX_[game];
+        int playerY = playerY_[game];
+
+        // Usually no ghost shares the player's tile; find out without a branch per ghost
+        std::size_t first = game * GhostCount;
+        bool anyHit = false;
+        for (std::size_t g = first; g < first + GhostCount; ++g) {
+            anyHit |= (ghostX_[g] == playerX) & (ghostY_[g] == playerY);
+        }
+        if (!anyHit) return;
+
+        for (std::size_t g = first; g < first + GhostCount; ++g) {
+            if (ghostX_[g] != playerX || ghostY_[g] != playerY) continue;
+            if (ghostEaten_[g]) continue;
+
+            if (ghostFrightened_[g]) {
+                ghostEaten_[g] = 1;
+                ghostFrightened_[g] = 0;
+                score_[game] += GameConfig::GhostScore;
+                poweredUp_[game] = frightened_[game];
+            } else {
+                HandlePlayerDeath(game);
+                return;
+            }
+        }
+    }
+
+    void BatchEnvironment::HandlePlayerDeath(std::size_t game) {
+        lives_[game]--;
+        poweredUp_[game] = frightened_[game];
+
+        if (lives_[game] <= 0) {
+            gameState_[game] = static_cast<uint8_t>(GameState::GameOver);
+            UpdateTickTimes(game);
+        } else {
+            InitializePlayer(game);
+            InitializeGhosts(game);
+            ResetModes(game);
+            playerStepTimer_[game] = 0.0f;
+            ghostStepTimer_[game] = 0.0f;
+        }
+    }
+
+    void BatchEnvironment::InitializePlayer(std::size_t game) {
+        playerX_[game] = GameConfig::PlayerStartX;
+        playerY_[game] = GameConfig::PlayerStartY;
+        playerDirection_[game] = Direction::Left;
+        desiredDirection_[game] = Direction::Left;
+        poweredUp_[game] = 0;
+    }
+
+    void BatchEnvironment::InitializeGhosts(std::size_t game) {
+        for (std::size_t ghost = 0; ghost < GhostCount; ++ghost) {
+            std::size_t g = game * GhostCount + ghost;
+            ghostX_[g] = static_cast<int8_t>(GhostSpawns[ghost].X);
+            ghostY_[g] = static_cast<int8_t>(GhostSpawns[ghost].Y);
+            ghostTargetX_[g] = 0;
+            ghostTargetY_[g] = 0;
+            ghostDirection_[g] = GhostSpawns[ghost].StartDirection;
+            ghostMode_[g] = GhostMode::Scatter;
+            ghostFrightened_[g] = 0;
+            ghostEaten_[g] = 0;
+        }
+    }
+
+    float BatchEnvironment::GetGhostInterval(std::size_t game) const {
+        if (frightened_[game]) {
+            return GameConfig::GhostFrightenedStepInterval;
+        }
+        int pellets = pelletCount_[game];
+        if (pellets <= GameConfig::ElroyDotsThreshold2) {
+            return GameConfig::GhostStepInterval * 0.8f;
+        } else if (pellets <= GameConfig::ElroyDotsThreshold1) {
+            return GameConfig::GhostStepInterval * 0.9f;
+        }
+        return GameConfig::GhostStepInterval;
+    }
+
+}
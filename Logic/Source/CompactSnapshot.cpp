@@ -0,0 +1,159 @@
+#include "CompactSnapshot.hpp"
+#include "Varint.hpp"
+
+namespace Pacman {
+
+    namespace {
+
+        constexpr uint64_t MaxDirection = static_cast<uint64_t>(Direction::None);
+        constexpr uint64_t MaxGameState = static_cast<uint64_t>(GameState::Victory);
+        constexpr uint64_t MaxGhostType = static_cast<uint64_t>(GhostType::Orange);
+        constexpr uint64_t MaxGhostMode = static_cast<uint64_t>(GhostMode::Eaten);
+
+        enum PlayerFlags : uint8_t {
+            PoweredUpFlag = 1 << 0
+        };
+
+        enum GhostFlags : uint8_t {
+            FrightenedFlag = 1 << 0,
+            EatenFlag = 1 << 1
+        };
+
+        enum ModeFlags : uint8_t {
+            ScatterPhaseFlag = 1 << 0,
+            PermanentChaseFlag = 1 << 1,
+            ModeJustChangedFlag = 1 << 2,
+            ModeFrightenedFlag = 1 << 3
+        };
+
+        void WritePosition(const Vector2& position, std::vector<uint8_t>& out) {
+            WriteVarint(ZigZag(position.X), out);
+            WriteVarint(ZigZag(position.Y), out);
+        }
+
+        bool ReadPosition(VarintReader& reader, Vector2& position) {
+            return reader.ReadSigned(position.X) && reader.ReadSigned(position.Y);
+        }
+
+        /// @brief Tiles that hold a pellet of either kind in the pristine level
+        Bitboard LevelPellets(const LevelData& level) {
+            return level.Image.Pellets | level.Image.PowerPellets;
+        }
+
+    }
+
+    void EncodeCompactSnapshot(const EngineSnapshot& snapshot, const LevelData& level,
+                               std::vector<uint8_t>& out) {
+        // One bit per pellet of the level, set while it is still on the board
+        Bitboard remaining = snapshot.Board.GetPellets() | snapshot.Board.GetPowerPellets();
+        uint8_t bits = 0;
+        int bitCount = 0;
+        LevelPellets(level).ForEachSetBit([&](int index) {
+            bits |= static_cast<uint8_t>(remaining.Test(index)) << bitCount;
+            if (++bitCount == 8) {
+                out.push_back(bits);
+                bits = 0;
+                bitCount = 0;
+            }
+        });
+        if (bitCount) out.push_back(bits);
+
+        const PlayerState& player = snapshot.Player;
+        WritePosition(player.Position, out);
+        WriteVarint(ZigZag(player.Score), out);
+        WriteVarint(ZigZag(player.Lives), out);
+        out.push_back(static_cast<uint8_t>(player.CurrentDirection));
+        out.push_back(player.IsPoweredUp ? PoweredUpFlag : 0);
+        out.push_back(static_cast<uint8_t>(snapshot.DesiredDirection));
+
+        for (const GhostState& ghost : snapshot.Ghosts) {
+            WritePosition(ghost.Position, out);
+            WritePosition(ghost.TargetTile, out);
+            WritePosition(ghost.ScatterTarget, out);
+            out.push_back(static_cast<uint8_t>(ghost.CurrentDirection));
+            out.push_back(static_cast<uint8_t>(ghost.Type));
+            out.push_back(static_cast<uint8_t>(ghost.Mode));
+            out.push_back(static_cast<uint8_t>((ghost.IsFrightened ? FrightenedFlag : 0) |
+                                               (ghost.IsEaten ? EatenFlag : 0)));
+        }
+
+        GhostModeController::State mode = snapshot.ModeController.GetState();
+        WriteVarint(ZigZag(mode.CurrentWave), out);
+        WriteFloat(mode.WaveTimer, out);
+        WriteFloat(mode.FrightenedTimer, out);
+        out.push_back(static_cast<uint8_t>((mode.IsScatterPhase ? ScatterPhaseFlag : 0) |
+                                           (mode.IsPermanentChase ? PermanentChaseFlag : 0) |
+                                           (mode.ModeJustChanged ? ModeJustChangedFlag : 0) |
+                                           (mode.IsFrightened ? ModeFrightenedFlag : 0)));
+
+        out.push_back(static_cast<uint8_t>(snapshot.State));
+        WriteVarint(ZigZag(snapshot.GhostsEatenThisPowerUp), out);
+        WriteFloat(snapshot.PlayerStepTimer, out);
+        WriteFloat(snapshot.GhostStepTimer, out);
+        WriteVarint(snapshot.Seed, out);
+        WriteVarint(snapshot.Rng.GetState(), out);
+        WriteVarint(snapshot.LevelIndex, out);
+        WriteVarint(snapshot.Tick, out);
+    }
+
+    bool DecodeCompactSnapshot(std::span<const uint8_t> data, const LevelData& level,
+                               EngineSnapshot& snapshot) {
+        VarintReader reader(data);
+
+        snapshot.Board.Load(level.Image);
+        Bitboard pellets = LevelPellets(level);
+        std::span<const uint8_t> bits;
+        if (!reader.ReadBytes((pellets.Count() + 7) / 8, bits)) return false;
+        int bit = 0;
+        pellets.ForEachSetBit([&](int index) {
+            if (!(bits[bit / 8] & (1 << (bit % 8)))) {
+                snapshot.Board.SetTileAt({index % Map::Width, index / Map::Width}, TileType::Path);
+            }
+            ++bit;
+        });
+
+        PlayerState& player = snapshot.Player;
+        uint8_t flags = 0;
+        if (!ReadPosition(reader, player.Position) || !reader.ReadSigned(player.Score) ||
+            !reader.ReadSigned(player.Lives) || !reader.ReadBounded(player.CurrentDirection, MaxDirection) ||
+            !reader.ReadByte(flags) || !reader.ReadBounded(snapshot.DesiredDirection, MaxDirection)) {
+            return false;
+        }
+        player.IsPoweredUp = flags & PoweredUpFlag;
+
+        for (GhostState& ghost : snapshot.Ghosts) {
+            if (!ReadPosition(reader, ghost.Position) || !ReadPosition(reader, ghost.TargetTile) ||
+                !ReadPosition(reader, ghost.ScatterTarget) ||
+                !reader.ReadBounded(ghost.CurrentDirection, MaxDirection) ||
+                !reader.ReadBounded(ghost.Type, MaxGhostType) ||
+                !reader.ReadBounded(ghost.Mode, MaxGhostMode) || !reader.ReadByte(flags)) {
+                return false;
+            }
+            ghost.IsFrightened = flags & FrightenedFlag;
+            ghost.IsEaten = flags & EatenFlag;
+        }
+
+        GhostModeController::State mode;
+        if (!reader.ReadSigned(mode.CurrentWave) || !reader.ReadFloat(mode.WaveTimer) ||
+            !reader.ReadFloat(mode.FrightenedTimer) || !reader.ReadByte(flags)) {
+            return false;
+        }
+        mode.IsScatterPhase = flags & ScatterPhaseFlag;
+        mode.IsPermanentChase = flags & PermanentChaseFlag;
+        mode.ModeJustChanged = flags & ModeJustChangedFlag;
+        mode.IsFrightened = flags & ModeFrightenedFlag;
+        snapshot.ModeController.SetState(mode);
+
+        uint64_t rng = 0;
+        if (!reader.ReadBounded(snapshot.State, MaxGameState) ||
+            !reader.ReadSigned(snapshot.GhostsEatenThisPowerUp) ||
+            !reader.ReadFloat(snapshot.PlayerStepTimer) || !reader.ReadFloat(snapshot.GhostStepTimer) ||
+            !reader.ReadVarint(snapshot.Seed) || !reader.ReadVarint(rng) ||
+            !reader.ReadBounded(snapshot.LevelIndex, UINT32_MAX) || !reader.ReadBounded(snapshot.Tick, UINT32_MAX)) {
+            return false;
+        }
+        snapshot.Rng.SetState(rng);
+        return reader.AtEnd();
+    }
+
+}
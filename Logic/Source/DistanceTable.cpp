@@ -0,0 +1,80 @@
+#include "DistanceTable.hpp"
+
+#include <stdexcept>
+
+namespace Pacman {
+
+    namespace {
+
+        // Same tie-break order the ghosts use
+        constexpr Direction SearchOrder[] = {
+            Direction::Up, Direction::Left, Direction::Down, Direction::Right
+        };
+
+        bool CanStandOn(const Map& map, const Vector2& pos, const LevelData& level, MazeGraph::Mover mover) {
+            if (mover != MazeGraph::Mover::Player) return map.IsGhostWalkable(pos, true);
+            // The player may spawn inside a wall (as in the default maze) and can only walk out of it
+            return map.IsWalkable(pos) || pos == level.PlayerStart;
+        }
+
+    }
+
+    DistanceTable::DistanceTable(const LevelData& level, MazeGraph::Mover mover)
+        : mover_(mover), ownedNodeOf_(MazeGraph::TileCount, NoNode) {
+        const Map map(level.Image);
+        const MazeGraph& graph = level.Graph;
+
+        std::vector<int> tileOf;
+        for (int tile = 0; tile < MazeGraph::TileCount; ++tile) {
+            if (CanStandOn(map, MazeGraph::ToPosition(tile), level, mover)) {
+                ownedNodeOf_[tile] = static_cast<uint16_t>(tileOf.size());
+                tileOf.push_back(tile);
+            }
+        }
+        nodeCount_ = static_cast<int>(tileOf.size());
+        ownedDistances_.assign(static_cast<size_t>(nodeCount_) * nodeCount_, UnreachableDistance);
+        ownedNextHops_.assign(static_cast<size_t>(nodeCount_) * nodeCount_, Direction::None);
+
+        std::vector<int> queue(nodeCount_);
+        for (int source = 0; source < nodeCount_; ++source) {
+            uint8_t* distances = &ownedDistances_[static_cast<size_t>(source) * nodeCount_];
+            Direction* hops = &ownedNextHops_[static_cast<size_t>(source) * nodeCount_];
+            distances[source] = 0;
+
+            int head = 0;
+            int tail = 0;
+            queue[tail++] = source;
+            while (head < tail) {
+                int node = queue[head++];
+                int tile = tileOf[node];
+                uint8_t exits = graph.GetExits(tile, mover);
+
+                for (Direction dir : SearchOrder) {
+                    if (!(exits & MazeGraph::ExitBit(dir))) continue;
+                    int next = ownedNodeOf_[graph.GetNeighbor(tile, dir)];
+                    if (next == NoNode || distances[next] != UnreachableDistance) continue;
+
+                    int distance = distances[node] + 1;
+                    if (distance >= UnreachableDistance) {
+                        throw std::runtime_error("Maze too large for 8-bit distances");
+                    }
+                    distances[next] = static_cast<uint8_t>(distance);
+                    hops[next] = node == source ? dir : hops[node];
+                    queue[tail++] = next;
+                }
+            }
+        }
+
+        nodeOf_ = ownedNodeOf_;
+        distances_ = ownedDistances_;
+        nextHops_ = ownedNextHops_;
+    }
+
+    DistanceTable::DistanceTable(MazeGraph::Mover mover, int nodeCount,
+                                 std::span<const uint16_t> nodeMap,
+                                 std::span<const uint8_t> distances,
+                                 std::span<const Direction> nextHops)
+        : mover_(mover), nodeCount_(nodeCount),
+          nodeOf_(nodeMap), distances_(distances), nextHops_(nextHops) {}
+
+}
@@ -1,100 +1,131 @@
 #include "IGameEngine.hpp"
 #include "IGhost.hpp"
+#include "GhostStrategies.hpp"
 #include "GhostModeController.hpp"
 #include "Map.hpp"
+#include "MazeGraph.hpp"
+#include "DistanceTable.hpp"
+#include "LevelPack.hpp"
 #include "GameConfig.hpp"
+#include "Random.hpp"
+#include "TickProfiler.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <array>
 #include <random>
 #include <climits>
+#include <limits>
 
 namespace Pacman {
 
     class GameEngine : public IGameEngine {
     public:
-        GameEngine() {
-            ghostAIs_[0] = CreateRedAI();
-            ghostAIs_[1] = CreatePinkAI();
-            ghostAIs_[2] = CreateBlueAI();
-            ghostAIs_[3] = CreateOrangeAI();
-            rng_.seed(std::random_device{}());
+        explicit GameEngine(uint64_t seed) : seed_(seed) {
+            for (size_t i = 0; i < ghostStrategies_.size(); ++i) {
+                ghostStrategies_[i] = MakeGhostStrategy(static_cast<GhostType>(i));
+            }
+            SelectLevel(LevelPack::BuiltIn(), 0);
+            rng_.Seed(seed_);
+            ReserveFrameBuffers();
             InitializeGame();
         }
 
+        /// @brief Copy the game state of another engine, sharing its custom ghost AIs
+        GameEngine(const GameEngine& other) {
+            std::lock_guard<std::mutex> lock(other.mutex_);
+            ghostStates_ = other.ghostStates_;
+            ghostStrategies_ = other.ghostStrategies_;
+            SelectLevel(other.pack_, other.levelIndex_);
+            map_ = other.map_;
+            gameState_ = other.gameState_;
+            playerState_ = other.playerState_;
+            desiredDirection_ = other.desiredDirection_;
+            modeController_ = other.modeController_;
+            ghostsEatenThisPowerUp_ = other.ghostsEatenThisPowerUp_;
+            playerStepTimer_ = other.playerStepTimer_;
+            ghostStepTimer_ = other.ghostStepTimer_;
+            seed_ = other.seed_;
+            rng_ = other.rng_;
+            tick_ = other.tick_;
+            keyframeInterval_ = other.keyframeInterval_;
+            // Input queued for the original's next Update applies to the clone's too
+            pendingDirection_.store(other.pendingDirection_.load(std::memory_order_acquire), std::memory_order_relaxed);
+            pendingPause_.store(other.pendingPause_.load(std::memory_order_acquire), std::memory_order_relaxed);
+            ReserveFrameBuffers();
+        }
+
+        GameEngine& operator=(const GameEngine&) = delete;
+
         ~GameEngine() override = default;
 
         void StartNewGame() override {
             std::lock_guard<std::mutex> lock(mutex_);
-            map_.Initialize();
+            map_.Load(level_->Image);
             ResetPlayerForNewGame();
             InitializeGhosts();
             modeController_.Reset();
             playerStepTimer_ = 0.0f;
             ghostStepTimer_ = 0.0f;
             ghostsEatenThisPowerUp_ = 0;
+            // Every game of an engine replays the same random sequence for the same inputs
+            rng_.Seed(seed_);
             gameState_ = GameState::Running;
+            // Input queued for the previous game must not leak into the new one
+            pendingDirection_.store(NoPendingInput, std::memory_order_relaxed);
+            pendingPause_.store(NoPendingInput, std::memory_order_relaxed);
+            ResetInputLog();
+            BeginFrame();
             NotifyAll();
+            LogInput({.Type = InputLogType::GameStarted, .Seed = seed_, .LevelIndex = levelIndex_});
+            EndFrame();
         }
 
         void Update(float deltaTime) override {
             std::lock_guard<std::mutex> lock(mutex_);
-            if (gameState_ != GameState::Running) return;
-
-            // Update ghost mode timing
-            GhostMode previousMode = modeController_.GetCurrentMode();
-            modeController_.Update(deltaTime);
-            GhostMode currentMode = modeController_.GetCurrentMode();
-
-            // Ghosts reverse direction on mode change
-            if (modeController_.ShouldReverseDirection()) {
-                ReverseGhostDirections();
-                NotifyGhostModeChanged(currentMode);
-            }
-
-            // Handle frightened mode ending
-            if (previousMode == GhostMode::Frightened && currentMode != GhostMode::Frightened) {
-                for (auto& ghost : ghostStates_) {
-                    ghost.IsFrightened = false;
-                }
-                ghostsEatenThisPowerUp_ = 0;
-            }
-
-            // Update player
-            playerStepTimer_ += deltaTime;
-            while (playerStepTimer_ >= GameConfig::PlayerStepInterval) {
-                UpdatePlayer();
-                playerStepTimer_ -= GameConfig::PlayerStepInterval;
+            COSMIC_PROFILE_SCOPE(Update);
+            BeginFrame();
+            if (keyframeInterval_ && tick_ && tick_ % keyframeInterval_ == 0 && !listeners_.empty() &&
+                (gameState_ == GameState::Running || gameState_ == GameState::Paused)) {
+                CaptureSnapshot(keyframe_);
+                LogInput({.Type = InputLogType::Keyframe, .Tick = tick_, .DeltaTime = loggedDeltaTime_,
+                          .Snapshot = &keyframe_, .Level = level_});
             }
-
-            // Update ghosts
-            float ghostInterval = GetCurrentGhostInterval();
-            ghostStepTimer_ += deltaTime;
-            while (ghostStepTimer_ >= ghostInterval) {
-                UpdateGhosts();
-                ghostStepTimer_ -= ghostInterval;
+            if (deltaTime != loggedDeltaTime_) {
+                loggedDeltaTime_ = deltaTime;
+                LogInput({.Type = InputLogType::DeltaTime, .Tick = tick_, .DeltaTime = deltaTime});
             }
-
-            CheckCollisions();
-
-            // Win condition
-            if (map_.GetPelletCount() == 0) {
-                gameState_ = GameState::Victory;
-                NotifyGameState();
+            ApplyPendingInput();
+            if (gameState_ == GameState::Running) {
+                Step(deltaTime);
+                if (gameState_ == GameState::GameOver || gameState_ == GameState::Victory) {
+                    LogInput({.Type = InputLogType::GameEnded, .Tick = tick_ + 1, .State = gameState_,
+                              .Player = playerState_, .PelletCount = map_.GetPelletCount()});
+                }
             }
+            ++tick_;
+            EndFrame();
         }
 
         void SetPaused(bool isPaused) override {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (gameState_ == GameState::GameOver || gameState_ == GameState::Victory) return;
-            gameState_ = isPaused ? GameState::Paused : GameState::Running;
-            NotifyGameState();
+            pendingPause_.store(isPaused ? 1 : 0, std::memory_order_release);
+        }
+
+        void TogglePaused() override {
+            // Fold the toggle into whatever is already queued, so no request is lost
+            int pending = pendingPause_.load(std::memory_order_relaxed);
+            int toggled;
+            do {
+                toggled = pending == NoPendingInput ? PendingToggle
+                        : pending == PendingToggle ? NoPendingInput
+                        : !pending;
+            } while (!pendingPause_.compare_exchange_weak(pending, toggled, std::memory_order_release,
+                                                          std::memory_order_relaxed));
         }
 
         void SetPlayerDirection(Direction direction) override {
-            std::lock_guard<std::mutex> lock(mutex_);
-            desiredDirection_ = direction;
+            pendingDirection_.store(static_cast<int>(direction), std::memory_order_release);
         }
 
         GameState GetState() const override { return gameState_; }
@@ -108,10 +139,104 @@ namespace Pacman {
             return std::vector<GhostState>(ghostStates_.begin(), ghostStates_.end());
         }
 
+        void CopyPelletPositions(std::vector<Vector2>& positions) const override {
+            positions.clear();
+            map_.ForEachPellet([&](const Vector2& pos) { positions.push_back(pos); });
+        }
+
+        void CopyGhostStates(std::vector<GhostState>& states) const override {
+            states.assign(ghostStates_.begin(), ghostStates_.end());
+        }
+
         GhostMode GetGlobalGhostMode() const override {
             return modeController_.GetCurrentMode();
         }
 
+        void SaveSnapshot(EngineSnapshot& snapshot) const override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            CaptureSnapshot(snapshot);
+        }
+
+        void CaptureSnapshot(EngineSnapshot& snapshot) const {
+            snapshot.Board = map_;
+            snapshot.Player = playerState_;
+            snapshot.DesiredDirection = desiredDirection_;
+            snapshot.Ghosts = ghostStates_;
+            snapshot.ModeController = modeController_;
+            snapshot.State = gameState_;
+            snapshot.GhostsEatenThisPowerUp = ghostsEatenThisPowerUp_;
+            snapshot.PlayerStepTimer = playerStepTimer_;
+            snapshot.GhostStepTimer = ghostStepTimer_;
+            snapshot.Seed = seed_;
+            snapshot.Rng = rng_;
+            snapshot.LevelIndex = levelIndex_;
+            snapshot.Tick = tick_;
+        }
+
+        bool RestoreSnapshot(const EngineSnapshot& snapshot) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (snapshot.LevelIndex >= pack_->GetLevelCount()) return false;
+            SelectLevel(pack_, snapshot.LevelIndex);
+            map_ = snapshot.Board;
+            playerState_ = snapshot.Player;
+            desiredDirection_ = snapshot.DesiredDirection;
+            ghostStates_ = snapshot.Ghosts;
+            modeController_ = snapshot.ModeController;
+            gameState_ = snapshot.State;
+            ghostsEatenThisPowerUp_ = snapshot.GhostsEatenThisPowerUp;
+            playerStepTimer_ = snapshot.PlayerStepTimer;
+            ghostStepTimer_ = snapshot.GhostStepTimer;
+            seed_ = snapshot.Seed;
+            rng_ = snapshot.Rng;
+            tick_ = snapshot.Tick;
+            loggedDeltaTime_ = std::numeric_limits<float>::quiet_NaN();
+            pendingDirection_.store(NoPendingInput, std::memory_order_relaxed);
+            pendingPause_.store(NoPendingInput, std::memory_order_relaxed);
+            return true;
+        }
+
+        std::shared_ptr<IGameEngine> Clone() const override {
+            return std::make_shared<GameEngine>(*this);
+        }
+
+        std::shared_ptr<const DistanceTable> GetDistanceTable(MazeGraph::Mover mover) const override {
+            return pack_->GetDistanceTable(levelIndex_, mover);
+        }
+
+        bool LoadLevel(std::shared_ptr<const LevelPack> pack, uint32_t index) override {
+            if (!pack || index >= pack->GetLevelCount()) return false;
+            std::lock_guard<std::mutex> lock(mutex_);
+            SelectLevel(std::move(pack), index);
+            InitializeGame();
+            pendingDirection_.store(NoPendingInput, std::memory_order_relaxed);
+            pendingPause_.store(NoPendingInput, std::memory_order_relaxed);
+            // Renderers cache the maze; tell them it changed and what the new board looks like
+            BeginFrame();
+            NotifyLevelLoaded();
+            NotifyAll();
+            EndFrame();
+            return true;
+        }
+
+        uint32_t GetLevelIndex() const override {
+            return levelIndex_;
+        }
+
+        void SetGhostAI(GhostType type, std::shared_ptr<const IGhost> ai) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& strategy = ghostStrategies_[static_cast<size_t>(type)];
+            strategy = ai ? GhostStrategy(CustomStrategy{std::move(ai)}) : MakeGhostStrategy(type);
+        }
+
+        void SetKeyframeInterval(uint32_t ticks) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            keyframeInterval_ = ticks;
+        }
+
+        uint64_t GetSeed() const override {
+            return seed_;
+        }
+
         void AddListener(std::shared_ptr<IEventListener> listener) override {
             std::lock_guard<std::mutex> lock(mutex_);
             listeners_.push_back(listener);
@@ -122,20 +247,127 @@ namespace Pacman {
             listeners_.erase(std::remove(listeners_.begin(), listeners_.end(), listener), listeners_.end());
         }
 
+        void AddFrameListener(std::shared_ptr<IFrameListener> listener) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            frameListeners_.push_back(listener);
+        }
+
+        void RemoveFrameListener(std::shared_ptr<IFrameListener> listener) override {
+            std::lock_guard<std::mutex> lock(mutex_);
+            frameListeners_.erase(std::remove(frameListeners_.begin(), frameListeners_.end(), listener),
+                                  frameListeners_.end());
+        }
+
     private:
+        static constexpr int NoPendingInput = -1;
+        // Pause slot only: flip whatever state the engine is in
+        static constexpr int PendingToggle = 2;
+
+        // Tie-break order when several exits are equally close to the target
+        static constexpr std::array<Direction, 4> GhostPriorities = {
+            Direction::Up, Direction::Left, Direction::Down, Direction::Right
+        };
+
+        /// @brief Drain the latest input written by SetPlayerDirection/SetPaused
+        void ApplyPendingInput() {
+            int direction = pendingDirection_.exchange(NoPendingInput, std::memory_order_acquire);
+            if (direction != NoPendingInput && static_cast<Direction>(direction) != desiredDirection_) {
+                desiredDirection_ = static_cast<Direction>(direction);
+                LogInput({.Type = InputLogType::Direction, .Tick = tick_, .Input = desiredDirection_});
+            }
+
+            int pause = pendingPause_.exchange(NoPendingInput, std::memory_order_acquire);
+            if (pause == PendingToggle) pause = gameState_ != GameState::Paused;
+            if (pause != NoPendingInput &&
+                gameState_ != GameState::GameOver && gameState_ != GameState::Victory) {
+                GameState previous = gameState_;
+                gameState_ = pause ? GameState::Paused : GameState::Running;
+                if (gameState_ != previous) {
+                    LogInput({.Type = pause ? InputLogType::Paused : InputLogType::Resumed, .Tick = tick_});
+                }
+                NotifyGameState();
+            }
+        }
+
+        /// @brief Advance a running game by deltaTime
+        void Step(float deltaTime) {
+            {
+                COSMIC_PROFILE_SCOPE(ModeController);
+                // Update ghost mode timing
+                GhostMode previousMode = modeController_.GetCurrentMode();
+                modeController_.Update(deltaTime);
+                GhostMode currentMode = modeController_.GetCurrentMode();
+
+                // Ghosts reverse direction on mode change
+                if (modeController_.ShouldReverseDirection()) {
+                    ReverseGhostDirections();
+                    NotifyGhostModeChanged(currentMode);
+                }
+
+                // Handle frightened mode ending
+                if (previousMode == GhostMode::Frightened && currentMode != GhostMode::Frightened) {
+                    for (auto& ghost : ghostStates_) {
+                        ghost.IsFrightened = false;
+                    }
+                    ghostsEatenThisPowerUp_ = 0;
+                    if (recordFrame_) frameModes_.push_back(currentMode);
+                    // Listeners must see the ghosts turn dangerous before any collision this tick
+                    NotifyGhostsUpdated();
+                }
+            }
+
+            // Update player
+            {
+                COSMIC_PROFILE_SCOPE(Player);
+                playerStepTimer_ += deltaTime;
+                while (playerStepTimer_ >= GameConfig::PlayerStepInterval) {
+                    UpdatePlayer();
+                    playerStepTimer_ -= GameConfig::PlayerStepInterval;
+                }
+            }
+
+            // Update ghosts
+            {
+                COSMIC_PROFILE_SCOPE(Ghosts);
+                float ghostInterval = GetCurrentGhostInterval();
+                ghostStepTimer_ += deltaTime;
+                while (ghostStepTimer_ >= ghostInterval) {
+                    UpdateGhosts();
+                    ghostStepTimer_ -= ghostInterval;
+                }
+            }
+
+            COSMIC_PROFILE_SCOPE(Collisions);
+            CheckCollisions();
+
+            // Win condition
+            if (map_.GetPelletCount() == 0) {
+                gameState_ = GameState::Victory;
+                NotifyGameState();
+            }
+        }
+
+        void SelectLevel(std::shared_ptr<const LevelPack> pack, uint32_t index) {
+            pack_ = std::move(pack);
+            levelIndex_ = index;
+            level_ = &pack_->GetLevel(index);
+            graph_ = &level_->Graph;
+        }
+
         void InitializeGame() {
-            map_.Initialize();
+            map_.Load(level_->Image);
             ResetPlayerForNewGame();
             InitializeGhosts();
             modeController_.Reset();
             gameState_ = GameState::Paused;
+            ResetInputLog();
         }
 
         void InitializePlayer() {
-            playerState_.Position = {GameConfig::PlayerStartX, GameConfig::PlayerStartY};
-            playerState_.CurrentDirection = Direction::Left;
+            playerState_.Position = level_->PlayerStart;
+            playerState_.CurrentDirection = level_->PlayerStartDirection;
             playerState_.IsPoweredUp = false;
-            desiredDirection_ = Direction::Left;
+            desiredDirection_ = level_->PlayerStartDirection;
         }
 
         void ResetPlayerForNewGame() {
@@ -145,40 +377,14 @@ namespace Pacman {
         }
 
         void InitializeGhosts() {
-            ghostStates_[0] = GhostState{
-                {13, 11}, Direction::Left, false, false,
-                GhostType::Red, GhostMode::Scatter, "Red",
-                {0, 0}, ghostAIs_[0]->GetScatterTarget()
-            };
-            ghostStates_[1] = GhostState{
-                {13, 14}, Direction::Down, false, false,
-                GhostType::Pink, GhostMode::Scatter, "Pink",
-                {0, 0}, ghostAIs_[1]->GetScatterTarget()
-            };
-            ghostStates_[2] = GhostState{
-                {11, 14}, Direction::Up, false, false,
-                GhostType::Blue, GhostMode::Scatter, "Blue",
-                {0, 0}, ghostAIs_[2]->GetScatterTarget()
-            };
-            ghostStates_[3] = GhostState{
-                {15, 14}, Direction::Up, false, false,
-                GhostType::Orange, GhostMode::Scatter, "Orange",
-                {0, 0}, ghostAIs_[3]->GetScatterTarget()
-            };
-        }
-
-        Vector2 GetNextPosition(const Vector2& from, Direction dir) const {
-            Vector2 delta = GetDirectionDelta(dir);
-            Vector2 next = {from.X + delta.X, from.Y + delta.Y};
-            return map_.WrapPosition(next);
-        }
-
-        bool CanWalk(const Vector2& from, Direction dir) const {
-            return map_.IsWalkable(GetNextPosition(from, dir));
-        }
-
-        bool CanGhostWalk(const Vector2& from, Direction dir, bool canUseGhostDoor = false) const {
-            return map_.IsGhostWalkable(GetNextPosition(from, dir), canUseGhostDoor);
+            for (size_t i = 0; i < ghostStates_.size(); ++i) {
+                ghostStates_[i] = GhostState{
+                    .Position = level_->GhostSpawns[i].Position,
+                    .ScatterTarget = level_->ScatterTargets[i],
+                    .CurrentDirection = level_->GhostSpawns[i].StartDirection,
+                    .Type = static_cast<GhostType>(i)
+                };
+            }
         }
 
         float GetCurrentGhostInterval() const {
@@ -195,13 +401,17 @@ namespace Pacman {
         }
 
         void UpdatePlayer() {
-            if (desiredDirection_ != Direction::None && CanWalk(playerState_.Position, desiredDirection_)) {
+            int tile = MazeGraph::ToIndex(playerState_.Position);
+            uint8_t exits = graph_->GetPlayerExits(tile);
+
+            if (desiredDirection_ != Direction::None && (exits & MazeGraph::ExitBit(desiredDirection_))) {
                 playerState_.CurrentDirection = desiredDirection_;
             }
 
             if (playerState_.CurrentDirection != Direction::None &&
-                CanWalk(playerState_.Position, playerState_.CurrentDirection)) {
-                playerState_.Position = GetNextPosition(playerState_.Position, playerState_.CurrentDirection);
+                (exits & MazeGraph::ExitBit(playerState_.CurrentDirection))) {
+                playerState_.Position =
+                    MazeGraph::ToPosition(graph_->GetNeighbor(tile, playerState_.CurrentDirection));
                 TryConsumeTile(playerState_.Position);
                 NotifyPlayerState();
             }
@@ -258,9 +468,9 @@ namespace Pacman {
                 }
 
                 if (ghost.CurrentDirection != Direction::None) {
-                    bool canUseGhostDoor = IsInOrNearGhostHouse(ghost.Position);
-                    if (CanGhostWalk(ghost.Position, ghost.CurrentDirection, canUseGhostDoor)) {
-                        ghost.Position = GetNextPosition(ghost.Position, ghost.CurrentDirection);
+                    int tile = MazeGraph::ToIndex(ghost.Position);
+                    if (graph_->GetGhostExits(tile) & MazeGraph::ExitBit(ghost.CurrentDirection)) {
+                        ghost.Position = MazeGraph::ToPosition(graph_->GetNeighbor(tile, ghost.CurrentDirection));
                     }
                 }
             }
@@ -280,79 +490,74 @@ namespace Pacman {
                 ghost.TargetTile = ghost.ScatterTarget;
                 ghost.Mode = GhostMode::Scatter;
             } else {
-                ghost.TargetTile = ghostAIs_[index]->CalculateChaseTarget(ghost, playerState_, blinkyPos);
+                ghost.TargetTile = CalculateChaseTarget(ghostStrategies_[index], ghost, playerState_, blinkyPos);
                 ghost.Mode = GhostMode::Chase;
             }
         }
 
         Direction ChooseGhostDirection(const GhostState& ghost) {
-            Direction opposite = GetOppositeDirection(ghost.CurrentDirection);
-            std::array<Direction, 4> priorities = {
-                Direction::Up, Direction::Left, Direction::Down, Direction::Right
-            };
+            const MazeGraph::Node& node = graph_->GetNode(MazeGraph::ToIndex(ghost.Position));
+            uint8_t exits = node.GhostExits & ~MazeGraph::ExitBit(GetOppositeDirection(ghost.CurrentDirection));
 
             Direction bestDir = Direction::None;
-            int bestDistSq = INT_MAX;
-            bool canUseGhostDoor = IsInOrNearGhostHouse(ghost.Position);
-
-            for (Direction dir : priorities) {
-                if (dir == opposite) continue;
-                if (!CanGhostWalk(ghost.Position, dir, canUseGhostDoor)) continue;
-
-                if (ghost.IsFrightened) {
-                    // Random direction when frightened
-                    std::uniform_int_distribution<int> dist(0, 3);
-                    if (dist(rng_) == 0 || bestDir == Direction::None) {
-                        bestDir = dir;
-                    }
-                } else {
-                    // Minimize distance to target
-                    Vector2 nextPos = GetNextPosition(ghost.Position, dir);
-                    int distSq = nextPos.DistanceSquared(ghost.TargetTile);
-                    if (distSq < bestDistSq) {
-                        bestDistSq = distSq;
+            if (ghost.IsFrightened) {
+                // Random direction when frightened
+                for (Direction dir : GhostPriorities) {
+                    if (!(exits & MazeGraph::ExitBit(dir))) continue;
+                    if (rng_.NextInt(4) == 0 || bestDir == Direction::None) {
                         bestDir = dir;
                     }
                 }
+                return bestDir;
+            }
+
+            // Minimize distance to target
+            int bestDistSq = INT_MAX;
+            for (Direction dir : GhostPriorities) {
+                if (!(exits & MazeGraph::ExitBit(dir))) continue;
+                Vector2 nextPos = MazeGraph::ToPosition(node.Neighbors[static_cast<int>(dir)]);
+                int distSq = nextPos.DistanceSquared(ghost.TargetTile);
+                if (distSq < bestDistSq) {
+                    bestDistSq = distSq;
+                    bestDir = dir;
+                }
             }
             return bestDir;
         }
 
         void UpdateEatenGhost(GhostState& ghost) {
-            Vector2 houseTarget = {GameConfig::GhostHouseX, GameConfig::GhostHouseDoorY};
+            Vector2 houseTarget = level_->GhostHouseDoor;
 
             if (ghost.Position == houseTarget ||
-                (ghost.Position.Y >= GameConfig::GhostHouseDoorY &&
-                 std::abs(ghost.Position.X - GameConfig::GhostHouseX) <= 2)) {
+                (ghost.Position.Y >= houseTarget.Y && std::abs(ghost.Position.X - houseTarget.X) <= 2)) {
                 ghost.IsEaten = false;
                 ghost.IsFrightened = modeController_.IsFrightened();
-                ghost.Position = {GameConfig::GhostHouseX, GameConfig::GhostHouseY};
+                ghost.Position = level_->GhostHouse;
                 return;
             }
 
+            const MazeGraph::Node& node = graph_->GetNode(MazeGraph::ToIndex(ghost.Position));
             Direction opposite = GetOppositeDirection(ghost.CurrentDirection);
-            std::array<Direction, 4> priorities = {
-                Direction::Up, Direction::Left, Direction::Down, Direction::Right
-            };
-
             Direction bestDir = Direction::None;
+            Vector2 bestPos = ghost.Position;
             int bestDistSq = INT_MAX;
 
-            for (Direction dir : priorities) {
+            for (Direction dir : GhostPriorities) {
                 if (dir == opposite && bestDir != Direction::None) continue;
-                if (!CanGhostWalk(ghost.Position, dir, true)) continue;
+                if (!(node.EatenExits & MazeGraph::ExitBit(dir))) continue;
 
-                Vector2 nextPos = GetNextPosition(ghost.Position, dir);
+                Vector2 nextPos = MazeGraph::ToPosition(node.Neighbors[static_cast<int>(dir)]);
                 int distSq = nextPos.DistanceSquared(houseTarget);
                 if (distSq < bestDistSq) {
                     bestDistSq = distSq;
                     bestDir = dir;
+                    bestPos = nextPos;
                 }
             }
 
             if (bestDir != Direction::None) {
                 ghost.CurrentDirection = bestDir;
-                ghost.Position = GetNextPosition(ghost.Position, bestDir);
+                ghost.Position = bestPos;
             }
         }
 
@@ -364,10 +569,6 @@ namespace Pacman {
             }
         }
 
-        bool IsInOrNearGhostHouse(const Vector2& pos) const {
-            return pos.Y >= 12 && pos.Y <= 16 && pos.X >= 10 && pos.X <= 17;
-        }
-
         void CheckCollisions() {
             for (auto& ghost : ghostStates_) {
                 if (ghost.Position == playerState_.Position) {
@@ -408,51 +609,132 @@ namespace Pacman {
             }
         }
 
+        void ReserveFrameBuffers() {
+            // A frame rarely eats more than one tile or sees more than one mode change
+            frameTiles_.reserve(8);
+            frameModes_.reserve(8);
+        }
+
+        void BeginFrame() {
+            recordFrame_ = !frameListeners_.empty();
+            frameTiles_.clear();
+            frameModes_.clear();
+            frame_.PlayerChanged = false;
+            frame_.GhostsChanged = false;
+            frame_.StateChanged = false;
+        }
+
+        /// @brief Deliver everything recorded since BeginFrame as one event per frame listener
+        void EndFrame() {
+            if (!recordFrame_) return;
+            COSMIC_PROFILE_SCOPE(Notification);
+            frame_.EatenTiles = frameTiles_;
+            frame_.ModeTransitions = frameModes_;
+            frame_.Player = playerState_;
+            frame_.Player.IsPoweredUp = modeController_.IsFrightened();
+            frame_.Ghosts = ghostStates_;
+            frame_.State = gameState_;
+            for (auto& l : frameListeners_) if (l) l->OnFrame(frame_);
+        }
+
         void NotifyAll() {
             NotifyGameState();
             NotifyPlayerState();
             NotifyGhostsUpdated();
         }
 
+        void NotifyLevelLoaded() {
+            COSMIC_PROFILE_SCOPE(Notification);
+            for (auto& l : listeners_) if (l) l->OnLevelLoaded(levelIndex_);
+        }
+
         void NotifyTileUpdated(const TileUpdate& update) {
+            COSMIC_PROFILE_SCOPE(Notification);
+            if (recordFrame_) frameTiles_.push_back(update);
             for (auto& l : listeners_) if (l) l->OnTileUpdated(update);
         }
 
         void NotifyPlayerState() {
+            COSMIC_PROFILE_SCOPE(Notification);
             playerState_.IsPoweredUp = modeController_.IsFrightened();
+            frame_.PlayerChanged = true;
             for (auto& l : listeners_) if (l) l->OnPlayerStateChanged(playerState_);
         }
 
         void NotifyGameState() {
+            COSMIC_PROFILE_SCOPE(Notification);
+            frame_.StateChanged = true;
             for (auto& l : listeners_) if (l) l->OnGameStateChanged(gameState_);
         }
 
         void NotifyGhostsUpdated() {
-            std::vector<GhostState> states(ghostStates_.begin(), ghostStates_.end());
-            for (auto& l : listeners_) if (l) l->OnGhostsUpdated(states);
+            COSMIC_PROFILE_SCOPE(Notification);
+            frame_.GhostsChanged = true;
+            for (auto& l : listeners_) if (l) l->OnGhostsUpdated(ghostStates_);
+        }
+
+        /// @brief Restart tick numbering; the next Update logs its deltaTime
+        void ResetInputLog() {
+            tick_ = 0;
+            loggedDeltaTime_ = std::numeric_limits<float>::quiet_NaN();
+        }
+
+        void LogInput(const InputLogEntry& entry) {
+            COSMIC_PROFILE_SCOPE(Notification);
+            for (auto& l : listeners_) if (l) l->OnInputLogged(entry);
         }
 
         void NotifyGhostModeChanged(GhostMode mode) {
+            COSMIC_PROFILE_SCOPE(Notification);
+            if (recordFrame_) frameModes_.push_back(mode);
             for (auto& l : listeners_) if (l) l->OnGhostModeChanged(mode);
         }
 
         mutable std::mutex mutex_;
+        // Latest-value slots written by the input thread without taking mutex_
+        std::atomic<int> pendingDirection_{NoPendingInput};
+        std::atomic<int> pendingPause_{NoPendingInput};
         std::vector<std::shared_ptr<IEventListener>> listeners_;
+        std::vector<std::shared_ptr<IFrameListener>> frameListeners_;
+        // Per-frame scratch; cleared, never shrunk, so steady-state frames do not allocate
+        FrameDelta frame_;
+        std::vector<TileUpdate> frameTiles_;
+        std::vector<GhostMode> frameModes_;
+        bool recordFrame_ = false;
         Map map_;
         GameState gameState_ = GameState::Paused;
         PlayerState playerState_{};
         Direction desiredDirection_ = Direction::None;
-        std::array<GhostState, 4> ghostStates_;
-        std::array<std::unique_ptr<IGhost>, 4> ghostAIs_;
+        // Ghosts and player are read on every step; keep them on their own cache lines
+        alignas(64) std::array<GhostState, 4> ghostStates_;
+        // Built-in rules are dispatched statically; only custom IGhost AIs pay for a virtual call
+        std::array<GhostStrategy, 4> ghostStrategies_;
+        // Read-only maze data shared by every engine playing the same pack
+        std::shared_ptr<const LevelPack> pack_;
+        uint32_t levelIndex_ = 0;
+        const LevelData* level_ = nullptr;
+        const MazeGraph* graph_ = nullptr;
         GhostModeController modeController_;
         int ghostsEatenThisPowerUp_ = 0;
         float playerStepTimer_ = 0.0f;
         float ghostStepTimer_ = 0.0f;
-        mutable std::mt19937 rng_;
+        uint64_t seed_ = 0;
+        Random rng_;
+        uint32_t tick_ = 0;
+        // NaN until the first Update, so that call always logs its deltaTime
+        float loggedDeltaTime_ = std::numeric_limits<float>::quiet_NaN();
+        uint32_t keyframeInterval_ = DefaultKeyframeInterval;
+        // Scratch for keyframes handed to listeners
+        EngineSnapshot keyframe_;
     };
 
     std::shared_ptr<IGameEngine> CreateGameEngine() {
-        return std::make_shared<GameEngine>();
+        std::random_device device;
+        return CreateGameEngine((static_cast<uint64_t>(device()) << 32) | device());
+    }
+
+    std::shared_ptr<IGameEngine> CreateGameEngine(uint64_t seed) {
+        return std::make_shared<GameEngine>(seed);
     }
 
 }
\ No newline at end of file
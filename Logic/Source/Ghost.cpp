@@ -1,15 +1,16 @@
 #include "IGhost.hpp"
 #include "GameConfig.hpp"
+#include "GhostStrategies.hpp"
 
 namespace Pacman {
     
     class RedAI : public IGhost {
     public:
         Vector2 CalculateChaseTarget(
-            const GhostState&,
+            const GhostState& ghost,
             const PlayerState& player,
-            const Vector2&) const override {
-            return player.Position;
+            const Vector2& redPosition) const override {
+            return RedStrategy::ChaseTarget(ghost, player, redPosition);
         }
 
         Vector2 GetScatterTarget() const override {
@@ -24,20 +25,10 @@ namespace Pacman {
     class PinkAI : public IGhost {
     public:
         Vector2 CalculateChaseTarget(
-            const GhostState&,
+            const GhostState& ghost,
             const PlayerState& player,
-            const Vector2&) const override {
-            Vector2 target = player.Position;
-            Vector2 delta = GetDirectionDelta(player.CurrentDirection);
-
-            target.X += delta.X * GameConfig::PinkTargetAhead;
-            target.Y += delta.Y * GameConfig::PinkTargetAhead;
-
-            if (player.CurrentDirection == Direction::Up) {
-                target.X -= GameConfig::PinkTargetAhead;
-            }
-            
-            return target;
+            const Vector2& redPosition) const override {
+            return PinkStrategy::ChaseTarget(ghost, player, redPosition);
         }
 
         Vector2 GetScatterTarget() const override {
@@ -52,24 +43,10 @@ namespace Pacman {
     class BlueAI : public IGhost {
     public:
         Vector2 CalculateChaseTarget(
-            const GhostState&,
+            const GhostState& ghost,
             const PlayerState& player,
             const Vector2& redPosition) const override {
-            Vector2 pivotPoint = player.Position;
-            Vector2 delta = GetDirectionDelta(player.CurrentDirection);
-            
-            pivotPoint.X += delta.X * GameConfig::BlueTargetAhead;
-            pivotPoint.Y += delta.Y * GameConfig::BlueTargetAhead;
-
-            if (player.CurrentDirection == Direction::Up) {
-                pivotPoint.X -= GameConfig::BlueTargetAhead;
-            }
-
-            Vector2 target;
-            target.X = 2 * pivotPoint.X - redPosition.X;
-            target.Y = 2 * pivotPoint.Y - redPosition.Y;
-            
-            return target;
+            return BlueStrategy::ChaseTarget(ghost, player, redPosition);
         }
 
         Vector2 GetScatterTarget() const override {
@@ -86,15 +63,9 @@ namespace Pacman {
         Vector2 CalculateChaseTarget(
             const GhostState& ghost,
             const PlayerState& player,
-            const Vector2&) const override
-        {
-            float distance = ghost.Position.Distance(player.Position);
-
-            if (distance > static_cast<float>(GameConfig::OrangeShyDistance)) {
-                return player.Position;
-            }
-
-            return GetScatterTarget();
+            const Vector2&) const override {
+            // GhostState::ScatterTarget is only filled in by the engine; standalone callers get the GameConfig corner
+            return OrangeStrategy::IsShy(ghost, player) ? GetScatterTarget() : player.Position;
         }
 
         Vector2 GetScatterTarget() const override {
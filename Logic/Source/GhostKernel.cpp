@@ -0,0 +1,125 @@
+#include "GhostKernel.hpp"
+#include "GhostKernelSimd.hpp"
+#include "GhostStrategies.hpp"
+
+#include <array>
+#include <climits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define COSMIC_GHOST_KERNEL_X64 1
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace Pacman {
+
+    namespace {
+
+#if defined(COSMIC_GHOST_KERNEL_X64)
+
+        // SSE2 is part of x86-64, so this needs no special build flags
+        struct Sse2Ops {
+            using Vec = __m128i;
+            static constexpr std::size_t Width = 8;
+
+            static Vec Load(const int16_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static void Store(int16_t* p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+            static Vec Set1(int16_t value) { return _mm_set1_epi16(value); }
+            static Vec Add(Vec a, Vec b) { return _mm_add_epi16(a, b); }
+            static Vec Sub(Vec a, Vec b) { return _mm_sub_epi16(a, b); }
+            static Vec Mul(Vec a, Vec b) { return _mm_mullo_epi16(a, b); }
+            static Vec CmpEq(Vec a, Vec b) { return _mm_cmpeq_epi16(a, b); }
+            static Vec CmpGt(Vec a, Vec b) { return _mm_cmpgt_epi16(a, b); }
+            static Vec And(Vec a, Vec b) { return _mm_and_si128(a, b); }
+            static Vec Select(Vec mask, Vec a, Vec b) {
+                return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+            }
+        };
+
+        bool CpuHasAvx2() {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) return false;
+            __cpuid(info, 1);
+            bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+            __cpuidex(info, 7, 0);
+            return osSavesYmm && (info[1] & (1 << 5));
+#else
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+
+#endif
+
+        // Same tie-break order GameEngine uses
+        constexpr std::array<Direction, 4> GhostPriorities = {
+            Direction::Up, Direction::Left, Direction::Down, Direction::Right
+        };
+
+        /// @brief Reference path: the engine's own rules, one lane at a time
+        void RunGhostKernelScalar(const GhostKernelBatch& batch, std::size_t begin) {
+            for (std::size_t i = begin; i < batch.Count; ++i) {
+                GhostState ghost{};
+                ghost.Position = {batch.GhostX[i], batch.GhostY[i]};
+                ghost.ScatterTarget = batch.ScatterTarget;
+                PlayerState player{};
+                player.Position = {batch.PlayerX[i], batch.PlayerY[i]};
+                player.CurrentDirection = static_cast<Direction>(batch.PlayerDirection[i]);
+                Vector2 blinky = {batch.BlinkyX[i], batch.BlinkyY[i]};
+
+                Vector2 target = batch.ScatterTarget;
+                if (batch.Chase[i]) {
+                    target = CalculateChaseTarget(MakeGhostStrategy(batch.Type), ghost, player, blinky);
+                }
+
+                Direction bestDir = Direction::None;
+                int bestDistSq = INT_MAX;
+                for (Direction dir : GhostPriorities) {
+                    if (!(batch.Exits[i] & (1 << static_cast<int>(dir)))) continue;
+                    Vector2 next = ghost.Position + GetDirectionDelta(dir);
+                    if (next.X < 0) next.X = GameConfig::MapWidth - 1;
+                    else if (next.X >= GameConfig::MapWidth) next.X = 0;
+                    int distSq = next.DistanceSquared(target);
+                    if (distSq < bestDistSq) {
+                        bestDistSq = distSq;
+                        bestDir = dir;
+                    }
+                }
+
+                batch.TargetX[i] = static_cast<int16_t>(target.X);
+                batch.TargetY[i] = static_cast<int16_t>(target.Y);
+                batch.NewDirection[i] = static_cast<int16_t>(bestDir);
+            }
+        }
+
+    }
+
+    SimdLevel DetectSimdLevel() {
+#if defined(COSMIC_GHOST_KERNEL_X64)
+        static const SimdLevel level = HasGhostKernelAvx2() && CpuHasAvx2() ? SimdLevel::Avx2 : SimdLevel::Sse2;
+        return level;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    void RunGhostKernel(const GhostKernelBatch& batch, SimdLevel level) {
+        if (level > DetectSimdLevel()) level = DetectSimdLevel();
+
+        std::size_t done = 0;
+#if defined(COSMIC_GHOST_KERNEL_X64)
+        if (level == SimdLevel::Avx2) {
+            done = RunGhostKernelAvx2(batch);
+        }
+        if (level != SimdLevel::Scalar) {
+            // A block of 8 left over by AVX2, or everything for SSE2
+            done = RunGhostKernelLanes<Sse2Ops>(batch, done);
+        }
+#endif
+        RunGhostKernelScalar(batch, done);
+    }
+
+}
@@ -0,0 +1,48 @@
+// Built with AVX2 enabled (see Logic/CMakeLists.txt); only called after
+// DetectSimdLevel() has confirmed the CPU supports it.
+
+#include "GhostKernelSimd.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace Pacman {
+
+#if defined(__AVX2__)
+
+    namespace {
+
+        struct Avx2Ops {
+            using Vec = __m256i;
+            static constexpr std::size_t Width = 16;
+
+            static Vec Load(const int16_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            static void Store(int16_t* p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+            static Vec Set1(int16_t value) { return _mm256_set1_epi16(value); }
+            static Vec Add(Vec a, Vec b) { return _mm256_add_epi16(a, b); }
+            static Vec Sub(Vec a, Vec b) { return _mm256_sub_epi16(a, b); }
+            static Vec Mul(Vec a, Vec b) { return _mm256_mullo_epi16(a, b); }
+            static Vec CmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi16(a, b); }
+            static Vec CmpGt(Vec a, Vec b) { return _mm256_cmpgt_epi16(a, b); }
+            static Vec And(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+            static Vec Select(Vec mask, Vec a, Vec b) { return _mm256_blendv_epi8(b, a, mask); }
+        };
+
+    }
+
+    bool HasGhostKernelAvx2() { return true; }
+
+    std::size_t RunGhostKernelAvx2(const GhostKernelBatch& batch) {
+        return RunGhostKernelLanes<Avx2Ops>(batch, 0);
+    }
+
+#else
+
+    bool HasGhostKernelAvx2() { return false; }
+
+    std::size_t RunGhostKernelAvx2(const GhostKernelBatch&) { return 0; }
+
+#endif
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+// Private to GhostKernel.cpp and GhostKernelAvx2.cpp. Each includes this
+// after defining its own Ops type, and everything here has internal linkage,
+// so code built with -mavx2 can never be picked for the baseline build.
+
+#include "GhostKernel.hpp"
+#include "GameConfig.hpp"
+
+namespace Pacman {
+
+    /// @brief True if this build contains the AVX2 kernel
+    bool HasGhostKernelAvx2();
+
+    /// @brief AVX2 part of the kernel; returns how many leading lanes it computed
+    std::size_t RunGhostKernelAvx2(const GhostKernelBatch& batch);
+
+    namespace {
+
+        /// @brief Whole Ops::Width blocks of lanes from begin on
+        ///
+        /// Ops wraps one register type: Width int16_t lanes, Load/Store, Set1,
+        /// Add, Sub, Mul (low 16 bits), CmpEq/CmpGt (all-ones mask), And and
+        /// Select(mask, ifTrue, ifFalse). Returns the first lane not computed.
+        template <typename Ops>
+        std::size_t RunGhostKernelLanes(const GhostKernelBatch& batch, std::size_t begin) {
+            using Vec = typename Ops::Vec;
+            constexpr int16_t Up = static_cast<int16_t>(Direction::Up);
+            constexpr int16_t Down = static_cast<int16_t>(Direction::Down);
+            constexpr int16_t Left = static_cast<int16_t>(Direction::Left);
+            constexpr int16_t Right = static_cast<int16_t>(Direction::Right);
+            constexpr int16_t None = static_cast<int16_t>(Direction::None);
+            constexpr int16_t ShyDistanceSq = GameConfig::OrangeShyDistance * GameConfig::OrangeShyDistance;
+
+            const Vec zero = Ops::Set1(0);
+            const Vec one = Ops::Set1(1);
+            const Vec scatterX = Ops::Set1(static_cast<int16_t>(batch.ScatterTarget.X));
+            const Vec scatterY = Ops::Set1(static_cast<int16_t>(batch.ScatterTarget.Y));
+            const Vec lastColumn = Ops::Set1(GameConfig::MapWidth - 1);
+
+            std::size_t end = begin + (batch.Count - begin) / Ops::Width * Ops::Width;
+            for (std::size_t i = begin; i < end; i += Ops::Width) {
+                Vec gx = Ops::Load(batch.GhostX + i);
+                Vec gy = Ops::Load(batch.GhostY + i);
+                Vec px = Ops::Load(batch.PlayerX + i);
+                Vec py = Ops::Load(batch.PlayerY + i);
+                Vec pd = Ops::Load(batch.PlayerDirection + i);
+
+                // GetDirectionDelta: masks are -1 where true
+                Vec isUp = Ops::CmpEq(pd, Ops::Set1(Up));
+                Vec dx = Ops::Sub(Ops::CmpEq(pd, Ops::Set1(Left)), Ops::CmpEq(pd, Ops::Set1(Right)));
+                Vec dy = Ops::Sub(isUp, Ops::CmpEq(pd, Ops::Set1(Down)));
+
+                Vec tx = px;
+                Vec ty = py;
+                switch (batch.Type) {
+                    case GhostType::Pink:
+                        tx = Ops::Add(Ops::Add(px, Ops::Mul(dx, Ops::Set1(GameConfig::PinkTargetAhead))),
+                                      Ops::And(isUp, Ops::Set1(-GameConfig::PinkTargetAhead)));
+                        ty = Ops::Add(py, Ops::Mul(dy, Ops::Set1(GameConfig::PinkTargetAhead)));
+                        break;
+                    case GhostType::Blue: {
+                        Vec pivotX = Ops::Add(Ops::Add(px, Ops::Mul(dx, Ops::Set1(GameConfig::BlueTargetAhead))),
+                                              Ops::And(isUp, Ops::Set1(-GameConfig::BlueTargetAhead)));
+                        Vec pivotY = Ops::Add(py, Ops::Mul(dy, Ops::Set1(GameConfig::BlueTargetAhead)));
+                        tx = Ops::Sub(Ops::Add(pivotX, pivotX), Ops::Load(batch.BlinkyX + i));
+                        ty = Ops::Sub(Ops::Add(pivotY, pivotY), Ops::Load(batch.BlinkyY + i));
+                        break;
+                    }
+                    case GhostType::Orange: {
+                        Vec ox = Ops::Sub(gx, px);
+                        Vec oy = Ops::Sub(gy, py);
+                        Vec far = Ops::CmpGt(Ops::Add(Ops::Mul(ox, ox), Ops::Mul(oy, oy)), Ops::Set1(ShyDistanceSq));
+                        tx = Ops::Select(far, px, scatterX);
+                        ty = Ops::Select(far, py, scatterY);
+                        break;
+                    }
+                    default:
+                        break;
+                }
+
+                Vec chase = Ops::CmpEq(Ops::CmpEq(Ops::Load(batch.Chase + i), zero), zero);
+                tx = Ops::Select(chase, tx, scatterX);
+                ty = Ops::Select(chase, ty, scatterY);
+
+                // Closest open exit, strict < so earlier priorities win ties
+                Vec exits = Ops::Load(batch.Exits + i);
+                Vec best = Ops::Set1(INT16_MAX);
+                Vec bestDir = Ops::Set1(None);
+                auto consider = [&](int16_t dir, Vec nx, Vec ny) {
+                    Vec bit = Ops::Set1(static_cast<int16_t>(1 << dir));
+                    Vec open = Ops::CmpEq(Ops::And(exits, bit), bit);
+                    Vec ex = Ops::Sub(nx, tx);
+                    Vec ey = Ops::Sub(ny, ty);
+                    Vec distance = Ops::Add(Ops::Mul(ex, ex), Ops::Mul(ey, ey));
+                    Vec better = Ops::And(open, Ops::CmpGt(best, distance));
+                    best = Ops::Select(better, distance, best);
+                    bestDir = Ops::Select(better, Ops::Set1(dir), bestDir);
+                };
+
+                // Side tunnel: stepping off one edge enters from the other
+                Vec leftX = Ops::Sub(gx, one);
+                leftX = Ops::Select(Ops::CmpGt(zero, leftX), lastColumn, leftX);
+                Vec rightX = Ops::Add(gx, one);
+                rightX = Ops::Select(Ops::CmpGt(rightX, lastColumn), zero, rightX);
+
+                consider(Up, gx, Ops::Sub(gy, one));
+                consider(Left, leftX, gy);
+                consider(Down, gx, Ops::Add(gy, one));
+                consider(Right, rightX, gy);
+
+                Ops::Store(batch.TargetX + i, tx);
+                Ops::Store(batch.TargetY + i, ty);
+                Ops::Store(batch.NewDirection + i, bestDir);
+            }
+            return end;
+        }
+
+    }
+
+}
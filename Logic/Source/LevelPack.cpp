@@ -0,0 +1,281 @@
+#include "LevelPack.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Pacman {
+
+    /// @brief Where one DistanceTable's arrays live inside the file
+    struct LevelPack::NavSection {
+        uint64_t NodeMapOffset;
+        uint64_t DistancesOffset;
+        uint64_t NextHopsOffset;
+        uint32_t NodeCount;
+        uint32_t Reserved;
+    };
+
+    namespace {
+
+        constexpr std::array<char, 8> Magic = {'C', 'S', 'M', 'C', 'P', 'A', 'C', 'K'};
+        constexpr uint64_t SectionAlignment = 64;
+        constexpr int MoverCount = 3;
+
+        // File layout: FileHeader, FileEntry[LevelCount], then 64-byte aligned
+        // LevelData records and distance table arrays at the offsets the entries give
+        struct FileHeader {
+            std::array<char, 8> Magic;
+            uint32_t Version;
+            uint32_t LevelCount;
+            uint32_t LevelSize;
+            uint32_t EntrySize;
+            uint64_t FileSize;
+        };
+
+        // Each LevelData record is immediately followed by its NavSection[MoverCount]
+        struct FileEntry {
+            uint64_t LevelOffset;
+        };
+
+        uint64_t AlignUp(uint64_t value) {
+            return (value + SectionAlignment - 1) & ~(SectionAlignment - 1);
+        }
+
+        bool FitsIn(uint64_t offset, uint64_t size, uint64_t fileSize) {
+            return offset % SectionAlignment == 0 && offset <= fileSize && size <= fileSize - offset;
+        }
+
+        bool IsOnBoard(const Vector2& pos) {
+            return pos.X >= 0 && pos.Y >= 0 && pos.X < MazeGraph::Width && pos.Y < MazeGraph::Height;
+        }
+
+        /// @brief Direction is a byte in the file, so any value can turn up
+        bool IsDirection(Direction direction) {
+            return static_cast<uint8_t>(direction) <= static_cast<uint8_t>(Direction::None);
+        }
+
+        /// @brief Reject records whose positions, directions, pellet count or
+        /// neighbor indices would send an engine off the board or out of its enums
+        bool IsPlayable(const LevelData& level) {
+            if (!IsOnBoard(level.PlayerStart) || !IsOnBoard(level.GhostHouse) || !IsOnBoard(level.GhostHouseDoor)) {
+                return false;
+            }
+            if (!IsDirection(level.PlayerStartDirection)) return false;
+            for (const GhostSpawn& spawn : level.GhostSpawns) {
+                if (!IsOnBoard(spawn.Position) || !IsDirection(spawn.StartDirection)) return false;
+            }
+            // The victory check counts down from PelletCount, so it must match the boards
+            if (level.Image.PelletCount != level.Image.Pellets.Count() + level.Image.PowerPellets.Count()) {
+                return false;
+            }
+            for (int tile = 0; tile < MazeGraph::TileCount; ++tile) {
+                for (int16_t neighbor : level.Graph.GetNode(tile).Neighbors) {
+                    if (neighbor < 0 || neighbor >= MazeGraph::TileCount) return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Read-only mapping of a whole file, or {nullptr, 0} on failure
+        std::pair<void*, std::size_t> MapFile(const std::string& path) {
+#ifdef _WIN32
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return {nullptr, 0};
+            LARGE_INTEGER size{};
+            if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+                CloseHandle(file);
+                return {nullptr, 0};
+            }
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (!mapping) return {nullptr, 0};
+            void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (!view) return {nullptr, 0};
+            return {view, static_cast<std::size_t>(size.QuadPart)};
+#else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) return {nullptr, 0};
+            struct stat info{};
+            if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+                ::close(fd);
+                return {nullptr, 0};
+            }
+            auto size = static_cast<std::size_t>(info.st_size);
+            void* view = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (view == MAP_FAILED) return {nullptr, 0};
+            return {view, size};
+#endif
+        }
+
+        void UnmapFile(void* view, std::size_t size) {
+#ifdef _WIN32
+            (void)size;
+            UnmapViewOfFile(view);
+#else
+            ::munmap(view, size);
+#endif
+        }
+
+    }
+
+    LevelPack::~LevelPack() {
+        // Tables may view the mapping, so they go first
+        entries_.reset();
+        if (mapping_) UnmapFile(mapping_, mappingSize_);
+    }
+
+    std::shared_ptr<const LevelPack> LevelPack::BuiltIn() {
+        static const std::shared_ptr<const LevelPack> pack = [] {
+            std::shared_ptr<LevelPack> builtIn(new LevelPack());
+            builtIn->levelCount_ = 1;
+            builtIn->entries_ = std::make_unique<Entry[]>(1);
+            builtIn->entries_[0].Level = &DefaultLevelData;
+            return builtIn;
+        }();
+        return pack;
+    }
+
+    std::shared_ptr<const LevelPack> LevelPack::Open(const std::string& path) {
+        auto [view, size] = MapFile(path);
+        if (!view) return nullptr;
+
+        // Owns the mapping from here on, so every early return unmaps it
+        std::shared_ptr<LevelPack> pack(new LevelPack());
+        pack->mapping_ = view;
+        pack->mappingSize_ = size;
+
+        const auto* bytes = static_cast<const unsigned char*>(view);
+        if (size < sizeof(FileHeader)) return nullptr;
+        FileHeader header;
+        std::memcpy(&header, bytes, sizeof(header));
+        if (header.Magic != Magic || header.Version != FormatVersion ||
+            header.LevelSize != sizeof(LevelData) || header.EntrySize != sizeof(FileEntry) ||
+            header.FileSize != size || header.LevelCount == 0) {
+            return nullptr;
+        }
+        uint64_t entriesSize = static_cast<uint64_t>(header.LevelCount) * sizeof(FileEntry);
+        if (entriesSize > size - sizeof(FileHeader)) return nullptr;
+
+        const auto* fileEntries = reinterpret_cast<const FileEntry*>(bytes + sizeof(FileHeader));
+        pack->levelCount_ = header.LevelCount;
+        pack->entries_ = std::make_unique<Entry[]>(header.LevelCount);
+
+        for (uint32_t i = 0; i < header.LevelCount; ++i) {
+            uint64_t levelOffset = fileEntries[i].LevelOffset;
+            uint64_t navSize = sizeof(NavSection) * MoverCount;
+            if (!FitsIn(levelOffset, sizeof(LevelData) + navSize, size)) return nullptr;
+
+            const auto* nav = reinterpret_cast<const NavSection*>(bytes + levelOffset + sizeof(LevelData));
+            for (int mover = 0; mover < MoverCount; ++mover) {
+                uint64_t nodes = nav[mover].NodeCount;
+                if (nodes > MazeGraph::TileCount ||
+                    !FitsIn(nav[mover].NodeMapOffset, MazeGraph::TileCount * sizeof(uint16_t), size) ||
+                    !FitsIn(nav[mover].DistancesOffset, nodes * nodes, size) ||
+                    !FitsIn(nav[mover].NextHopsOffset, nodes * nodes * sizeof(Direction), size)) {
+                    return nullptr;
+                }
+                // Every lookup indexes the distance rows through the node map
+                const auto* nodeMap = reinterpret_cast<const uint16_t*>(bytes + nav[mover].NodeMapOffset);
+                for (int tile = 0; tile < MazeGraph::TileCount; ++tile) {
+                    if (nodeMap[tile] != DistanceTable::NoNode && nodeMap[tile] >= nodes) return nullptr;
+                }
+                const auto* nextHops = reinterpret_cast<const Direction*>(bytes + nav[mover].NextHopsOffset);
+                for (uint64_t pair = 0; pair < nodes * nodes; ++pair) {
+                    if (!IsDirection(nextHops[pair])) return nullptr;
+                }
+            }
+
+            const auto* level = reinterpret_cast<const LevelData*>(bytes + levelOffset);
+            if (!IsPlayable(*level)) return nullptr;
+            pack->entries_[i].Level = level;
+            pack->entries_[i].Nav = nav;
+        }
+        return pack;
+    }
+
+    bool LevelPack::Write(const std::string& path, std::span<const LevelData> levels) {
+        if (levels.empty()) return false;
+
+        std::vector<unsigned char> file(AlignUp(sizeof(FileHeader) + levels.size() * sizeof(FileEntry)));
+        auto append = [&file](const void* data, std::size_t size) {
+            uint64_t offset = file.size();
+            const auto* source = static_cast<const unsigned char*>(data);
+            file.insert(file.end(), source, source + size);
+            file.resize(AlignUp(file.size()));
+            return offset;
+        };
+
+        for (std::size_t i = 0; i < levels.size(); ++i) {
+            const LevelData& level = levels[i];
+            std::array<NavSection, MoverCount> nav{};
+            std::vector<unsigned char> record(sizeof(LevelData) + sizeof(nav));
+            std::memcpy(record.data(), &level, sizeof(LevelData));
+            uint64_t levelOffset = append(record.data(), record.size());
+
+            for (int mover = 0; mover < MoverCount; ++mover) {
+                DistanceTable table(level, static_cast<MazeGraph::Mover>(mover));
+                nav[mover].NodeCount = static_cast<uint32_t>(table.GetNodeCount());
+                nav[mover].NodeMapOffset = append(table.GetNodeMap().data(), table.GetNodeMap().size_bytes());
+                nav[mover].DistancesOffset = append(table.GetDistances().data(), table.GetDistances().size_bytes());
+                nav[mover].NextHopsOffset = append(table.GetNextHops().data(), table.GetNextHops().size_bytes());
+            }
+            std::memcpy(file.data() + levelOffset + sizeof(LevelData), nav.data(), sizeof(nav));
+
+            FileEntry entry{};
+            entry.LevelOffset = levelOffset;
+            std::memcpy(file.data() + sizeof(FileHeader) + i * sizeof(FileEntry), &entry, sizeof(entry));
+        }
+
+        FileHeader header{};
+        header.Magic = Magic;
+        header.Version = FormatVersion;
+        header.LevelCount = static_cast<uint32_t>(levels.size());
+        header.LevelSize = sizeof(LevelData);
+        header.EntrySize = sizeof(FileEntry);
+        header.FileSize = file.size();
+        std::memcpy(file.data(), &header, sizeof(header));
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+        return static_cast<bool>(out);
+    }
+
+    std::shared_ptr<const DistanceTable> LevelPack::GetDistanceTable(uint32_t index, MazeGraph::Mover mover) const {
+        Entry& entry = entries_[index];
+        auto slot = static_cast<std::size_t>(mover);
+        std::call_once(entry.TableFlags[slot], [&] {
+            if (entry.Nav) {
+                const auto* bytes = static_cast<const unsigned char*>(mapping_);
+                const NavSection& nav = entry.Nav[slot];
+                std::size_t pairs = static_cast<std::size_t>(nav.NodeCount) * nav.NodeCount;
+                entry.Tables[slot] = std::make_unique<const DistanceTable>(
+                    mover, static_cast<int>(nav.NodeCount),
+                    std::span(reinterpret_cast<const uint16_t*>(bytes + nav.NodeMapOffset), MazeGraph::TileCount),
+                    std::span(reinterpret_cast<const uint8_t*>(bytes + nav.DistancesOffset), pairs),
+                    std::span(reinterpret_cast<const Direction*>(bytes + nav.NextHopsOffset), pairs));
+            } else {
+                entry.Tables[slot] = std::make_unique<const DistanceTable>(*entry.Level, mover);
+            }
+        });
+        // Aliasing constructor: callers holding a table keep the mapping alive
+        return std::shared_ptr<const DistanceTable>(shared_from_this(), entry.Tables[slot].get());
+    }
+
+}
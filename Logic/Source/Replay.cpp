@@ -0,0 +1,236 @@
+#include "Replay.hpp"
+#include "CompactSnapshot.hpp"
+#include "Varint.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Pacman {
+
+    namespace {
+
+        constexpr uint64_t ExtendedCode = 7;
+        constexpr uint64_t PausedCode = 5;
+        constexpr uint64_t ResumedCode = 6;
+
+        // Bounds the length field so a corrupt file cannot ask for a huge buffer
+        constexpr uint64_t MaxKeyframeBytes = 4096;
+
+        enum class Extended : uint8_t {
+            DeltaTime,
+            GameStarted,
+            GameEnded,
+            Keyframe
+        };
+
+        /// @brief One decoded item; Tick is relative to the previous one
+        struct Item {
+            InputLogEntry Entry;
+            ReplayKeyframe Keyframe;
+        };
+
+        bool ReadItem(VarintReader& reader, Item& item) {
+            uint64_t key = 0;
+            if (!reader.ReadVarint(key)) return false;
+            uint64_t delta = key >> 3;
+            uint64_t code = key & 7;
+            if (delta > UINT32_MAX) return false;
+            InputLogEntry& entry = item.Entry;
+            entry = InputLogEntry{};
+            entry.Tick = static_cast<uint32_t>(delta);
+
+            if (code <= static_cast<uint64_t>(Direction::None)) {
+                entry.Type = InputLogType::Direction;
+                entry.Input = static_cast<Direction>(code);
+                return true;
+            }
+            if (code == PausedCode || code == ResumedCode) {
+                entry.Type = code == PausedCode ? InputLogType::Paused : InputLogType::Resumed;
+                return true;
+            }
+
+            uint8_t subtype = 0;
+            if (!reader.ReadByte(subtype)) return false;
+            switch (static_cast<Extended>(subtype)) {
+                case Extended::DeltaTime:
+                    entry.Type = InputLogType::DeltaTime;
+                    return reader.ReadFloat(entry.DeltaTime);
+                case Extended::GameStarted:
+                    entry.Type = InputLogType::GameStarted;
+                    return reader.ReadVarint(entry.Seed) && reader.ReadBounded(entry.LevelIndex, UINT32_MAX);
+                case Extended::GameEnded:
+                    entry.Type = InputLogType::GameEnded;
+                    return reader.ReadBounded(entry.State, static_cast<uint64_t>(GameState::Victory)) &&
+                           reader.ReadSigned(entry.Player.Score) && reader.ReadSigned(entry.Player.Lives) &&
+                           reader.ReadBounded(entry.PelletCount, INT32_MAX) &&
+                           reader.ReadSigned(entry.Player.Position.X) && reader.ReadSigned(entry.Player.Position.Y);
+                case Extended::Keyframe: {
+                    entry.Type = InputLogType::Keyframe;
+                    std::size_t size = 0;
+                    std::span<const uint8_t> state;
+                    if (!reader.ReadFloat(entry.DeltaTime) || !reader.ReadBounded(size, MaxKeyframeBytes) ||
+                        !reader.ReadBytes(size, state)) {
+                        return false;
+                    }
+                    item.Keyframe.DeltaTime = entry.DeltaTime;
+                    item.Keyframe.State.assign(state.begin(), state.end());
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    }
+
+    void ReplayEncoder::EncodeHeader(std::vector<uint8_t>& out) {
+        out.insert(out.end(), std::begin(Magic), std::end(Magic));
+        WriteVarint(FormatVersion, out);
+    }
+
+    uint64_t ReplayEncoder::AdvanceTo(uint32_t tick) {
+        uint64_t delta = tick >= lastTick_ ? tick - lastTick_ : 0;
+        lastTick_ = std::max(lastTick_, tick);
+        return delta;
+    }
+
+    void ReplayEncoder::Encode(const InputLogEntry& entry, std::vector<uint8_t>& out) {
+        if (entry.Type == InputLogType::GameStarted) lastTick_ = 0;
+
+        switch (entry.Type) {
+            case InputLogType::Direction:
+                WriteVarint((AdvanceTo(entry.Tick) << 3) | static_cast<uint64_t>(entry.Input), out);
+                return;
+            case InputLogType::Paused:
+                WriteVarint((AdvanceTo(entry.Tick) << 3) | PausedCode, out);
+                return;
+            case InputLogType::Resumed:
+                WriteVarint((AdvanceTo(entry.Tick) << 3) | ResumedCode, out);
+                return;
+            case InputLogType::Keyframe: {
+                if (!entry.Snapshot || !entry.Level) return;
+                ReplayKeyframe keyframe{entry.Tick, entry.DeltaTime, std::move(scratch_)};
+                keyframe.State.clear();
+                EncodeCompactSnapshot(*entry.Snapshot, *entry.Level, keyframe.State);
+                EncodeKeyframe(keyframe, out);
+                // Keep the buffer for the next keyframe
+                scratch_ = std::move(keyframe.State);
+                return;
+            }
+            default:
+                break;
+        }
+
+        WriteVarint((AdvanceTo(entry.Tick) << 3) | ExtendedCode, out);
+        switch (entry.Type) {
+            case InputLogType::DeltaTime:
+                out.push_back(static_cast<uint8_t>(Extended::DeltaTime));
+                WriteFloat(entry.DeltaTime, out);
+                break;
+            case InputLogType::GameStarted:
+                out.push_back(static_cast<uint8_t>(Extended::GameStarted));
+                WriteVarint(entry.Seed, out);
+                WriteVarint(entry.LevelIndex, out);
+                break;
+            default:
+                out.push_back(static_cast<uint8_t>(Extended::GameEnded));
+                WriteVarint(static_cast<uint64_t>(entry.State), out);
+                WriteVarint(ZigZag(entry.Player.Score), out);
+                WriteVarint(ZigZag(entry.Player.Lives), out);
+                WriteVarint(static_cast<uint64_t>(std::max(entry.PelletCount, 0)), out);
+                WriteVarint(ZigZag(entry.Player.Position.X), out);
+                WriteVarint(ZigZag(entry.Player.Position.Y), out);
+                break;
+        }
+    }
+
+    void ReplayEncoder::EncodeKeyframe(const ReplayKeyframe& keyframe, std::vector<uint8_t>& out) {
+        WriteVarint((AdvanceTo(keyframe.Tick) << 3) | ExtendedCode, out);
+        out.push_back(static_cast<uint8_t>(Extended::Keyframe));
+        WriteFloat(keyframe.DeltaTime, out);
+        WriteVarint(keyframe.State.size(), out);
+        out.insert(out.end(), keyframe.State.begin(), keyframe.State.end());
+    }
+
+    std::vector<Replay> DecodeReplays(std::span<const uint8_t> data) {
+        std::vector<Replay> replays;
+        if (data.size() < sizeof(ReplayEncoder::Magic) ||
+            std::memcmp(data.data(), ReplayEncoder::Magic, sizeof(ReplayEncoder::Magic)) != 0) {
+            return replays;
+        }
+        VarintReader reader(data.subspan(sizeof(ReplayEncoder::Magic)));
+        uint64_t version = 0;
+        if (!reader.ReadVarint(version) || version < ReplayEncoder::MinFormatVersion ||
+            version > ReplayEncoder::FormatVersion) {
+            return replays;
+        }
+
+        Replay* current = nullptr;
+        uint32_t tick = 0;
+        Item item;
+        while (!reader.AtEnd() && ReadItem(reader, item)) {
+            InputLogEntry& entry = item.Entry;
+            if (entry.Type == InputLogType::GameStarted) {
+                current = &replays.emplace_back();
+                current->Seed = entry.Seed;
+                current->LevelIndex = entry.LevelIndex;
+                tick = 0;
+                continue;
+            }
+            // Entries before the first game, or after a game's end, belong to no game
+            if (!current || current->End) continue;
+
+            tick += entry.Tick;
+            entry.Tick = tick;
+            if (entry.Type == InputLogType::GameEnded) {
+                current->End = entry;
+            } else if (entry.Type == InputLogType::Keyframe) {
+                item.Keyframe.Tick = tick;
+                current->Keyframes.push_back(std::move(item.Keyframe));
+            } else {
+                current->Entries.push_back(entry);
+            }
+        }
+        return replays;
+    }
+
+    std::vector<Replay> LoadReplays(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) return {};
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        return DecodeReplays(data);
+    }
+
+    bool SaveReplays(const std::string& path, std::span<const Replay> replays) {
+        std::vector<uint8_t> data;
+        ReplayEncoder::EncodeHeader(data);
+        ReplayEncoder encoder;
+        for (const Replay& replay : replays) {
+            InputLogEntry start;
+            start.Type = InputLogType::GameStarted;
+            start.Seed = replay.Seed;
+            start.LevelIndex = replay.LevelIndex;
+            encoder.Encode(start, data);
+
+            // A keyframe goes before the entries of its own tick, as the engine logs it
+            auto keyframe = replay.Keyframes.begin();
+            for (const InputLogEntry& entry : replay.Entries) {
+                for (; keyframe != replay.Keyframes.end() && keyframe->Tick <= entry.Tick; ++keyframe) {
+                    encoder.EncodeKeyframe(*keyframe, data);
+                }
+                encoder.Encode(entry, data);
+            }
+            for (; keyframe != replay.Keyframes.end(); ++keyframe) {
+                encoder.EncodeKeyframe(*keyframe, data);
+            }
+            if (replay.End) encoder.Encode(*replay.End, data);
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        return static_cast<bool>(out);
+    }
+
+}
@@ -0,0 +1,88 @@
+#include "ReplayPlayer.hpp"
+#include "CompactSnapshot.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Pacman {
+
+    ReplayPlayer::ReplayPlayer(Replay replay, std::shared_ptr<const LevelPack> pack)
+        : replay_(std::move(replay)), pack_(std::move(pack)),
+          engine_(CreateGameEngine(replay_.Seed)) {
+        isValid_ = engine_->LoadLevel(pack_, replay_.LevelIndex);
+        if (isValid_) level_ = &pack_->GetLevel(replay_.LevelIndex);
+        if (replay_.End) {
+            endTick_ = replay_.End->Tick;
+        } else if (!replay_.Entries.empty()) {
+            endTick_ = replay_.Entries.back().Tick + 1;
+        }
+        Rewind();
+    }
+
+    void ReplayPlayer::Rewind() {
+        engine_->StartNewGame();
+        tick_ = 0;
+        nextEntry_ = 0;
+        deltaTime_ = DefaultDeltaTime;
+    }
+
+    void ReplayPlayer::Step() {
+        if (IsFinished()) return;
+
+        // Inputs go in before the Update that applied them during recording
+        while (nextEntry_ < replay_.Entries.size() && replay_.Entries[nextEntry_].Tick == tick_) {
+            const InputLogEntry& entry = replay_.Entries[nextEntry_++];
+            switch (entry.Type) {
+                case InputLogType::Direction: engine_->SetPlayerDirection(entry.Input); break;
+                case InputLogType::Paused: engine_->SetPaused(true); break;
+                case InputLogType::Resumed: engine_->SetPaused(false); break;
+                case InputLogType::DeltaTime: deltaTime_ = entry.DeltaTime; break;
+                default: break;
+            }
+        }
+        engine_->Update(deltaTime_);
+        ++tick_;
+        ++ticksSimulated_;
+    }
+
+    void ReplayPlayer::SeekTo(uint32_t tick) {
+        tick = std::min(tick, endTick_);
+
+        // Last keyframe at or before the target; jump to it unless the engine is already past it
+        auto keyframe = std::upper_bound(replay_.Keyframes.begin(), replay_.Keyframes.end(), tick,
+                                         [](uint32_t target, const ReplayKeyframe& k) { return target < k.Tick; });
+        bool jumped = false;
+        if (keyframe != replay_.Keyframes.begin()) {
+            --keyframe;
+            if (tick < tick_ || tick_ < keyframe->Tick) jumped = RestoreKeyframe(*keyframe);
+        }
+        if (!jumped && tick < tick_) Rewind();
+        while (tick_ < tick) Step();
+    }
+
+    bool ReplayPlayer::RestoreKeyframe(const ReplayKeyframe& keyframe) {
+        if (!level_ || !DecodeCompactSnapshot(keyframe.State, *level_, keyframeState_) ||
+            keyframeState_.Tick != keyframe.Tick || !engine_->RestoreSnapshot(keyframeState_)) {
+            return false;
+        }
+        tick_ = keyframe.Tick;
+        deltaTime_ = keyframe.DeltaTime;
+        // Entries logged at the keyframe's tick were applied after it was taken
+        nextEntry_ = std::lower_bound(replay_.Entries.begin(), replay_.Entries.end(), keyframe.Tick,
+                                      [](const InputLogEntry& e, uint32_t t) { return e.Tick < t; }) -
+                     replay_.Entries.begin();
+        return true;
+    }
+
+    bool ReplayPlayer::MatchesRecordedEnd() const {
+        if (!replay_.End || tick_ != endTick_) return false;
+        const InputLogEntry& end = *replay_.End;
+        PlayerState player = engine_->GetPlayerState();
+        return engine_->GetState() == end.State &&
+               player.Score == end.Player.Score &&
+               player.Lives == end.Player.Lives &&
+               player.Position == end.Player.Position &&
+               engine_->GetPelletCount() == end.PelletCount;
+    }
+
+}
@@ -0,0 +1,64 @@
+#include "ReplayRecorder.hpp"
+
+namespace Pacman {
+
+    ReplayRecorder::ReplayRecorder(const std::string& path)
+        : file_(path, std::ios::binary | std::ios::trunc) {
+        isOpen_ = static_cast<bool>(file_);
+        if (!isOpen_) return;
+        buffer_.reserve(FlushThreshold * 2);
+        ReplayEncoder::EncodeHeader(buffer_);
+        writer_ = std::thread(&ReplayRecorder::WriterLoop, this);
+    }
+
+    ReplayRecorder::~ReplayRecorder() {
+        if (!isOpen_) return;
+        Flush();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        writer_.join();
+    }
+
+    void ReplayRecorder::Flush() {
+        if (!isOpen_ || buffer_.empty()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            outgoing_.insert(outgoing_.end(), buffer_.begin(), buffer_.end());
+        }
+        wake_.notify_one();
+        buffer_.clear();
+    }
+
+    void ReplayRecorder::OnInputLogged(const InputLogEntry& entry) {
+        if (!isOpen_) return;
+        encoder_.Encode(entry, buffer_);
+        if (entry.Type == InputLogType::GameEnded || buffer_.size() >= FlushThreshold) {
+            Flush();
+        }
+    }
+
+    void ReplayRecorder::WriterLoop() {
+        std::vector<uint8_t> pending;
+        for (;;) {
+            bool stopping = false;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this] { return stopping_ || !outgoing_.empty(); });
+                pending.swap(outgoing_);
+                stopping = stopping_;
+            }
+            // Written outside the lock so the engine thread never waits on the disk
+            if (!pending.empty()) {
+                file_.write(reinterpret_cast<const char*>(pending.data()),
+                            static_cast<std::streamsize>(pending.size()));
+                file_.flush();
+                pending.clear();
+            }
+            if (stopping) break;
+        }
+    }
+
+}
@@ -0,0 +1,258 @@
+#include "TickProfiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Pacman {
+
+    void LatencyHistogram::Add(uint64_t value, uint64_t count) {
+        if (!count) return;
+        buckets_[BucketOf(value)] += count;
+        count_ += count;
+        sum_ += value * count;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    void LatencyHistogram::AddBuckets(const std::array<uint64_t, BucketCount>& counts, uint64_t sum,
+                                      uint64_t min, uint64_t max) {
+        uint64_t count = 0;
+        for (std::size_t i = 0; i < BucketCount; ++i) {
+            buckets_[i] += counts[i];
+            count += counts[i];
+        }
+        if (!count) return;
+        count_ += count;
+        sum_ += sum;
+        min_ = std::min(min_, min);
+        max_ = std::max(max_, max);
+    }
+
+    void LatencyHistogram::Merge(const LatencyHistogram& other) {
+        for (std::size_t i = 0; i < BucketCount; ++i) buckets_[i] += other.buckets_[i];
+        count_ += other.count_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    uint64_t LatencyHistogram::GetValueAtPercentile(double percentile) const {
+        if (!count_) return 0;
+        double clamped = std::clamp(percentile, 0.0, 100.0);
+        auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(clamped / 100.0 * static_cast<double>(count_) + 0.5));
+        uint64_t seen = 0;
+        for (std::size_t i = 0; i < BucketCount; ++i) {
+            seen += buckets_[i];
+            if (seen >= rank) return std::min(HighestValueOf(i), max_);
+        }
+        return max_;
+    }
+
+    namespace {
+
+        constexpr std::size_t PhaseCount = static_cast<std::size_t>(TickPhase::Count);
+
+        void Store(std::atomic<uint64_t>& counter, uint64_t value) {
+            counter.store(value, std::memory_order_relaxed);
+        }
+
+        uint64_t Load(const std::atomic<uint64_t>& counter) {
+            return counter.load(std::memory_order_relaxed);
+        }
+
+        /// @brief One thread's counters for one phase
+        struct PhaseCounters {
+            std::array<std::atomic<uint64_t>, LatencyHistogram::BucketCount> Buckets{};
+            std::atomic<uint64_t> Sum{0};
+            std::atomic<uint64_t> Min{UINT64_MAX};
+            std::atomic<uint64_t> Max{0};
+
+            /// @brief Snapshot as a histogram, added to the given one
+            void AddTo(LatencyHistogram& histogram) const {
+                std::array<uint64_t, LatencyHistogram::BucketCount> counts;
+                for (std::size_t b = 0; b < counts.size(); ++b) counts[b] = Load(Buckets[b]);
+                histogram.AddBuckets(counts, Load(Sum), Load(Min), Load(Max));
+            }
+
+            void Clear() {
+                for (auto& bucket : Buckets) Store(bucket, 0);
+                Store(Sum, 0);
+                Store(Min, UINT64_MAX);
+                Store(Max, 0);
+            }
+        };
+
+        /// @brief One thread's histograms
+        ///
+        /// Only the owning thread writes, so updates are a relaxed load and
+        /// store rather than a locked read-modify-write; the atomics only make
+        /// concurrent Collect calls well-defined.
+        struct ThreadHistograms {
+            std::array<PhaseCounters, PhaseCount> Phases{};
+        };
+
+        class Registry {
+        public:
+            ~Registry() {
+                if (TickProfiler::IsEnabled() && started_) TickProfiler::Dump(std::cerr);
+            }
+
+            void Register(ThreadHistograms& thread) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!started_) {
+                    started_ = true;
+                    startTicks_ = TickProfiler::Now();
+                    startTime_ = std::chrono::steady_clock::now();
+                }
+                threads_.push_back(&thread);
+            }
+
+            /// @brief Fold an exiting thread's timings into the totals and stop tracking it
+            void Retire(const ThreadHistograms& thread) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (std::size_t p = 0; p < PhaseCount; ++p) thread.Phases[p].AddTo(retired_[p]);
+                threads_.erase(std::remove(threads_.begin(), threads_.end(), &thread), threads_.end());
+            }
+
+            TickProfiler::Histograms Collect() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                TickProfiler::Histograms result = retired_;
+                for (const ThreadHistograms* thread : threads_) {
+                    for (std::size_t p = 0; p < PhaseCount; ++p) thread->Phases[p].AddTo(result[p]);
+                }
+                return result;
+            }
+
+            void Reset() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (LatencyHistogram& histogram : retired_) histogram.Clear();
+                for (ThreadHistograms* thread : threads_) {
+                    for (PhaseCounters& phase : thread->Phases) phase.Clear();
+                }
+            }
+
+            bool GetStart(uint64_t& ticks, std::chrono::steady_clock::time_point& time) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ticks = startTicks_;
+                time = startTime_;
+                return started_;
+            }
+
+        private:
+            std::mutex mutex_;
+            std::vector<ThreadHistograms*> threads_;
+            TickProfiler::Histograms retired_{};
+            bool started_ = false;
+            uint64_t startTicks_ = 0;
+            std::chrono::steady_clock::time_point startTime_;
+        };
+
+        Registry& GetRegistry() {
+            static Registry registry;
+            return registry;
+        }
+
+        // The plain pointer keeps the hot path free of the guard a thread_local with a destructor needs
+        thread_local ThreadHistograms* currentThread = nullptr;
+
+        /// @brief Owns the calling thread's histograms and hands them back to the registry on exit
+        class ThreadSlot {
+        public:
+            ~ThreadSlot() {
+                if (!histograms_) return;
+                GetRegistry().Retire(*histograms_);
+                histograms_.reset();
+                currentThread = nullptr;
+            }
+
+            ThreadHistograms& Acquire() {
+                histograms_ = std::make_unique<ThreadHistograms>();
+                GetRegistry().Register(*histograms_);
+                return *histograms_;
+            }
+
+        private:
+            std::unique_ptr<ThreadHistograms> histograms_;
+        };
+
+        thread_local ThreadSlot currentSlot;
+
+    }
+
+    void TickProfiler::Record(TickPhase phase, uint64_t duration) {
+        if (!currentThread) currentThread = &currentSlot.Acquire();
+        PhaseCounters& counters = currentThread->Phases[static_cast<std::size_t>(phase)];
+        std::atomic<uint64_t>& bucket = counters.Buckets[LatencyHistogram::BucketOf(duration)];
+        Store(bucket, Load(bucket) + 1);
+        Store(counters.Sum, Load(counters.Sum) + duration);
+        if (duration < Load(counters.Min)) Store(counters.Min, duration);
+        if (duration > Load(counters.Max)) Store(counters.Max, duration);
+    }
+
+    TickProfiler::Histograms TickProfiler::Collect() {
+        return GetRegistry().Collect();
+    }
+
+    double TickProfiler::GetTicksPerNanosecond() {
+#if defined(COSMIC_TICK_PROFILER_RDTSC)
+        uint64_t startTicks = 0;
+        std::chrono::steady_clock::time_point startTime;
+        if (!GetRegistry().GetStart(startTicks, startTime) ||
+            std::chrono::steady_clock::now() - startTime < std::chrono::milliseconds(10)) {
+            // Too little elapsed to trust; calibrate on the spot
+            startTicks = Now();
+            startTime = std::chrono::steady_clock::now();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        uint64_t ticks = Now() - startTicks;
+        auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        return nanoseconds > 0 ? static_cast<double>(ticks) / static_cast<double>(nanoseconds) : 1.0;
+#else
+        return 1.0;
+#endif
+    }
+
+    void TickProfiler::Reset() {
+        GetRegistry().Reset();
+    }
+
+    void TickProfiler::Dump(std::ostream& out) {
+        if (!IsEnabled()) {
+            out << "Tick profiler not compiled in (configure with -DENABLE_TICK_PROFILER=ON)\n";
+            return;
+        }
+        Histograms histograms = Collect();
+        double perNanosecond = GetTicksPerNanosecond();
+        auto ns = [&](double ticks) { return ticks / perNanosecond; };
+
+        std::ios_base::fmtflags flags = out.flags();
+        std::streamsize precision = out.precision();
+        out << "Tick profile, nanoseconds per call";
+#if defined(COSMIC_TICK_PROFILER_RDTSC)
+        out << " (TSC at " << std::fixed << std::setprecision(2) << perNanosecond << " GHz)";
+#endif
+        out << '\n' << std::left << std::setw(16) << "phase" << std::right << std::setw(12) << "count"
+            << std::setw(10) << "mean" << std::setw(10) << "p50" << std::setw(10) << "p90"
+            << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(10) << "max" << '\n';
+        out << std::fixed << std::setprecision(0);
+        for (std::size_t p = 0; p < PhaseCount; ++p) {
+            const LatencyHistogram& h = histograms[p];
+            out << std::left << std::setw(16) << TickPhaseNames[p] << std::right << std::setw(12) << h.GetCount()
+                << std::setw(10) << ns(h.GetMean());
+            for (double percentile : {50.0, 90.0, 99.0, 99.9}) {
+                out << std::setw(10) << ns(static_cast<double>(h.GetValueAtPercentile(percentile)));
+            }
+            out << std::setw(10) << ns(static_cast<double>(h.GetMax())) << '\n';
+        }
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+}
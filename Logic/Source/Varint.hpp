@@ -0,0 +1,102 @@
+#pragma once
+
+// Private to the replay and snapshot codecs: LEB128 varints, zigzag and a
+// bounds-checked reader.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Pacman {
+
+    inline void WriteVarint(uint64_t value, std::vector<uint8_t>& out) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    inline uint64_t ZigZag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    inline int64_t UnZigZag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    inline void WriteFloat(float value, std::vector<uint8_t>& out) {
+        auto bits = std::bit_cast<uint32_t>(value);
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+    }
+
+    /// @brief Bounds-checked cursor; every read fails once the data runs out
+    class VarintReader {
+    public:
+        explicit VarintReader(std::span<const uint8_t> data) : data_(data) {}
+
+        bool AtEnd() const { return offset_ >= data_.size(); }
+
+        bool ReadByte(uint8_t& value) {
+            if (AtEnd()) return false;
+            value = data_[offset_++];
+            return true;
+        }
+
+        bool ReadVarint(uint64_t& value) {
+            value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                uint8_t byte = 0;
+                if (!ReadByte(byte)) return false;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) return true;
+            }
+            return false;
+        }
+
+        /// @brief Varint that must fit in [0, limit]
+        template <typename T>
+        bool ReadBounded(T& value, uint64_t limit) {
+            uint64_t raw = 0;
+            if (!ReadVarint(raw) || raw > limit) return false;
+            value = static_cast<T>(raw);
+            return true;
+        }
+
+        /// @brief Zigzag varint that must fit in an int
+        bool ReadSigned(int& value) {
+            uint64_t raw = 0;
+            if (!ReadVarint(raw)) return false;
+            int64_t decoded = UnZigZag(raw);
+            if (decoded < INT32_MIN || decoded > INT32_MAX) return false;
+            value = static_cast<int>(decoded);
+            return true;
+        }
+
+        bool ReadFloat(float& value) {
+            uint32_t bits = 0;
+            for (int i = 0; i < 4; ++i) {
+                uint8_t byte = 0;
+                if (!ReadByte(byte)) return false;
+                bits |= static_cast<uint32_t>(byte) << (8 * i);
+            }
+            value = std::bit_cast<float>(bits);
+            return true;
+        }
+
+        /// @brief View of the next count bytes
+        bool ReadBytes(std::size_t count, std::span<const uint8_t>& bytes) {
+            if (count > data_.size() - offset_) return false;
+            bytes = data_.subspan(offset_, count);
+            offset_ += count;
+            return true;
+        }
+
+    private:
+        std::span<const uint8_t> data_;
+        std::size_t offset_ = 0;
+    };
+
+}
@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+#include "IGameEngine.hpp"
+#include "IEventListener.hpp"
+#include "IFrameListener.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+using namespace Pacman;
+
+// This file replaces the global allocation functions, so it is built as its
+// own test binary instead of being linked into CosmicTests. Every form of
+// operator new and delete is replaced, including the array, nothrow and
+// over-aligned ones, so no allocation can slip past the counter. Only
+// allocations made by a thread that has switched counting on are recorded,
+// so gtest's own bookkeeping on other threads does not leak into the result.
+namespace {
+
+    std::atomic<size_t> allocationCount{0};
+    thread_local bool countAllocations = false;
+
+    class AllocationScope {
+    public:
+        AllocationScope() : start_(allocationCount.load()) { countAllocations = true; }
+        ~AllocationScope() { countAllocations = false; }
+
+        size_t Count() const { return allocationCount.load() - start_; }
+
+    private:
+        size_t start_;
+    };
+
+    // Kept out of line so the compiler never pairs an inlined free() with a
+    // new-expression at a call site and reports a mismatch
+    [[gnu::noinline]] void* Allocate(std::size_t size) noexcept {
+        if (countAllocations) ++allocationCount;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    [[gnu::noinline]] void* AllocateAligned(std::size_t size, std::align_val_t alignment) noexcept {
+        if (countAllocations) ++allocationCount;
+        auto align = static_cast<std::size_t>(alignment);
+        size = (size + align - 1) / align * align;
+#if defined(_WIN32)
+        return _aligned_malloc(size == 0 ? align : size, align);
+#else
+        return std::aligned_alloc(align, size == 0 ? align : size);
+#endif
+    }
+
+    [[gnu::noinline]] void Release(void* p) noexcept {
+        std::free(p);
+    }
+
+    [[gnu::noinline]] void ReleaseAligned(void* p) noexcept {
+#if defined(_WIN32)
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+}
+
+void* operator new(std::size_t size) {
+    if (void* p = Allocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* p = Allocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return Allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return Allocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* p = AllocateAligned(size, alignment)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* p = AllocateAligned(size, alignment)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* p) noexcept { Release(p); }
+void operator delete[](void* p) noexcept { Release(p); }
+void operator delete(void* p, std::size_t) noexcept { Release(p); }
+void operator delete[](void* p, std::size_t) noexcept { Release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { Release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { Release(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { ReleaseAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { ReleaseAligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { ReleaseAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { ReleaseAligned(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { ReleaseAligned(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { ReleaseAligned(p); }
+
+namespace {
+
+    /// @brief Listener doing the kind of work a renderer does, without allocating
+    class RecordingListener : public IEventListener {
+    public:
+        void OnTileUpdated(const TileUpdate&) override { ++tiles; }
+        void OnPlayerStateChanged(const PlayerState& state) override { player = state.Position; }
+        void OnGameStateChanged(GameState state) override { gameState = state; }
+        void OnGhostsUpdated(std::span<const GhostState> ghosts) override {
+            for (size_t i = 0; i < ghosts.size() && i < positions.size(); ++i) {
+                positions[i] = ghosts[i].Position;
+            }
+            ++ghostUpdates;
+        }
+
+        std::array<Vector2, 4> positions{};
+        Vector2 player{0, 0};
+        GameState gameState = GameState::Paused;
+        int tiles = 0;
+        int ghostUpdates = 0;
+    };
+
+    /// @brief Frame listener that only counts, so it never allocates
+    class CountingFrameListener : public IFrameListener {
+    public:
+        void OnFrame(const FrameDelta& frame) override {
+            ++frames;
+            tiles += static_cast<int>(frame.EatenTiles.size());
+        }
+
+        int frames = 0;
+        int tiles = 0;
+    };
+
+}
+
+TEST(AllocationTest, Counter_SeesEveryFormOfNew) {
+    struct alignas(64) Line { char bytes[64]; };
+    // Published through a volatile so the optimiser cannot drop a new/delete pair
+    void* volatile escaped = nullptr;
+    size_t allocations = 0;
+    {
+        AllocationScope scope;
+        int* single = new int(1);
+        escaped = single;
+        delete single;
+        int* array = new int[4];
+        escaped = array;
+        delete[] array;
+        int* nothrow = new (std::nothrow) int(2);
+        escaped = nothrow;
+        delete nothrow;
+        Line* line = new Line;
+        escaped = line;
+        delete line;
+        Line* lines = new Line[2];
+        escaped = lines;
+        delete[] lines;
+        allocations = scope.Count();
+    }
+
+    EXPECT_EQ(allocations, 5u);
+    EXPECT_NE(escaped, nullptr);
+}
+
+TEST(AllocationTest, TenThousandTicks_WithListeners_DoNotAllocate) {
+    auto engine = CreateGameEngine(1);
+    auto listener = std::make_shared<RecordingListener>();
+    auto frameListener = std::make_shared<CountingFrameListener>();
+    engine->AddListener(listener);
+    engine->AddFrameListener(frameListener);
+    engine->StartNewGame();
+
+    constexpr Direction moves[] = {Direction::Left, Direction::Up, Direction::Right, Direction::Down};
+    size_t allocations = 0;
+    {
+        AllocationScope scope;
+        for (int tick = 0; tick < 10000; ++tick) {
+            if (engine->GetState() != GameState::Running) engine->StartNewGame();
+            engine->SetPlayerDirection(moves[(tick / 45) % 4]);
+            engine->Update(1.0f / 60.0f);
+        }
+        allocations = scope.Count();
+    }
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_GT(listener->ghostUpdates, 0);
+    EXPECT_GT(listener->tiles, 0);
+    EXPECT_EQ(frameListener->tiles, listener->tiles);
+}
+
+TEST(AllocationTest, CopyAccessors_ReuseCallerBuffers) {
+    auto engine = CreateGameEngine(2);
+    engine->StartNewGame();
+    std::vector<Vector2> pellets;
+    std::vector<GhostState> ghosts;
+    engine->CopyPelletPositions(pellets);
+    engine->CopyGhostStates(ghosts);
+
+    size_t allocations = 0;
+    {
+        AllocationScope scope;
+        for (int tick = 0; tick < 600 && engine->GetState() == GameState::Running; ++tick) {
+            engine->SetPlayerDirection(tick % 90 < 45 ? Direction::Left : Direction::Right);
+            engine->Update(1.0f / 60.0f);
+            engine->CopyPelletPositions(pellets);
+            engine->CopyGhostStates(ghosts);
+        }
+        allocations = scope.Count();
+    }
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(pellets.size(), static_cast<size_t>(engine->GetPelletCount()));
+    EXPECT_EQ(ghosts.size(), 4u);
+}
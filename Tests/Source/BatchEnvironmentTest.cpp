@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include "BatchEnvironment.hpp"
+#include "IGameEngine.hpp"
+#include "Map.hpp"
+
+#include <random>
+
+using namespace Pacman;
+
+namespace {
+
+    void ExpectSameState(const IGameEngine& engine, const BatchEnvironment& batch, std::size_t game) {
+        EXPECT_EQ(engine.GetState(), batch.GetState(game));
+        EXPECT_EQ(engine.GetPelletCount(), batch.GetPelletCount(game));
+
+        PlayerState expected = engine.GetPlayerState();
+        PlayerState actual = batch.GetPlayerState(game);
+        EXPECT_EQ(expected.Position, actual.Position);
+        EXPECT_EQ(expected.CurrentDirection, actual.CurrentDirection);
+        EXPECT_EQ(expected.Score, actual.Score);
+        EXPECT_EQ(expected.Lives, actual.Lives);
+        EXPECT_EQ(expected.IsPoweredUp, actual.IsPoweredUp);
+
+        std::vector<GhostState> expectedGhosts = engine.GetGhostStates();
+        auto actualGhosts = batch.GetGhostStates(game);
+        ASSERT_EQ(expectedGhosts.size(), actualGhosts.size());
+        for (std::size_t i = 0; i < actualGhosts.size(); ++i) {
+            EXPECT_EQ(expectedGhosts[i].Position, actualGhosts[i].Position);
+            EXPECT_EQ(expectedGhosts[i].CurrentDirection, actualGhosts[i].CurrentDirection);
+            EXPECT_EQ(expectedGhosts[i].IsFrightened, actualGhosts[i].IsFrightened);
+            EXPECT_EQ(expectedGhosts[i].IsEaten, actualGhosts[i].IsEaten);
+            EXPECT_EQ(expectedGhosts[i].Mode, actualGhosts[i].Mode);
+            EXPECT_EQ(expectedGhosts[i].TargetTile, actualGhosts[i].TargetTile);
+        }
+    }
+
+}
+
+TEST(BatchEnvironmentTest, Construction_AllGamesRunning) {
+    BatchEnvironment batch(16);
+    EXPECT_EQ(batch.GetGameCount(), 16u);
+    EXPECT_EQ(batch.GetRunningCount(), 16u);
+}
+
+TEST(BatchEnvironmentTest, InitialState_MatchesNewEngineGame) {
+    auto engine = CreateGameEngine();
+    engine->StartNewGame();
+    BatchEnvironment batch(1);
+
+    ExpectSameState(*engine, batch, 0);
+    EXPECT_EQ(batch.GetTileAt(0, {1, 1}), engine->GetTileAt({1, 1}));
+    EXPECT_EQ(batch.GetTileAt(0, {1, 3}), engine->GetTileAt({1, 3}));
+    EXPECT_EQ(batch.GetTileAt(0, {-1, 3}), TileType::Wall);
+}
+
+TEST(BatchEnvironmentTest, IdlePlayer_MatchesEngineUntilGameOver) {
+    auto engine = CreateGameEngine();
+    engine->StartNewGame();
+    BatchEnvironment batch(1);
+    std::vector<Direction> actions(1, Direction::None);
+
+    for (int tick = 0; tick < 100000 && engine->GetState() == GameState::Running; ++tick) {
+        engine->SetPlayerDirection(Direction::None);
+        engine->Update(batch.GetDeltaTime());
+        batch.Step(actions);
+        ExpectSameState(*engine, batch, 0);
+        if (HasFailure()) FAIL() << "Diverged at tick " << tick;
+    }
+    EXPECT_EQ(batch.GetState(0), GameState::GameOver);
+}
+
+TEST(BatchEnvironmentTest, RandomInputs_MatchSeededEngineForWholeGames) {
+    std::mt19937 inputs(1234);
+    std::uniform_int_distribution<int> pick(0, 4);
+
+    for (uint64_t seed = 0; seed < 8; ++seed) {
+        auto engine = CreateGameEngine(seed);
+        engine->StartNewGame();
+        BatchEnvironment batch(1, seed);
+        std::vector<Direction> actions(1);
+
+        for (int tick = 0; tick < 100000 && engine->GetState() == GameState::Running; ++tick) {
+            actions[0] = static_cast<Direction>(pick(inputs));
+            engine->SetPlayerDirection(actions[0]);
+            engine->Update(batch.GetDeltaTime());
+            batch.Step(actions);
+            ExpectSameState(*engine, batch, 0);
+            if (HasFailure()) FAIL() << "Diverged at tick " << tick << " with seed " << seed;
+        }
+        EXPECT_NE(batch.GetState(0), GameState::Running);
+    }
+}
+
+TEST(BatchEnvironmentTest, EverySimdLevel_MatchesSeededEngines) {
+    // 40 games fill AVX2 and SSE2 blocks and leave a scalar tail
+    constexpr std::size_t GameCount = 40;
+
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2}) {
+        BatchEnvironment batch(GameCount, 100);
+        batch.SetSimdLevel(level);
+        std::vector<std::shared_ptr<IGameEngine>> engines;
+        for (std::size_t game = 0; game < GameCount; ++game) {
+            engines.push_back(CreateGameEngine(100 + game));
+            engines.back()->StartNewGame();
+        }
+
+        std::mt19937 inputs(99);
+        std::uniform_int_distribution<int> pick(0, 4);
+        std::vector<Direction> actions(GameCount);
+        for (int tick = 0; tick < 20000 && batch.GetRunningCount() > 0; ++tick) {
+            for (std::size_t game = 0; game < GameCount; ++game) {
+                // A new direction every few ticks keeps players roaming the maze
+                if (tick % 8 == 0) actions[game] = static_cast<Direction>(pick(inputs));
+                engines[game]->SetPlayerDirection(actions[game]);
+                engines[game]->Update(batch.GetDeltaTime());
+            }
+            batch.Step(actions);
+            for (std::size_t game = 0; game < GameCount; ++game) {
+                ExpectSameState(*engines[game], batch, game);
+                if (HasFailure()) {
+                    FAIL() << "Game " << game << " diverged at tick " << tick
+                           << " with SIMD level " << static_cast<int>(batch.GetSimdLevel());
+                }
+            }
+        }
+        EXPECT_EQ(batch.GetRunningCount(), 0u);
+    }
+}
+
+TEST(BatchEnvironmentTest, Step_GamesAdvanceIndependently) {
+    BatchEnvironment batch(2);
+    std::vector<Direction> actions = {Direction::Up, Direction::Down};
+
+    for (int tick = 0; tick < 60; ++tick) {
+        batch.Step(actions);
+    }
+
+    EXPECT_LT(batch.GetPlayerPosition(0).Y, GameConfig::PlayerStartY);
+    EXPECT_GT(batch.GetPlayerPosition(1).Y, GameConfig::PlayerStartY);
+    EXPECT_NE(batch.GetScore(0), batch.GetScore(1));
+}
+
+TEST(BatchEnvironmentTest, ResetGame_OnlyResetsThatGame) {
+    BatchEnvironment batch(2);
+    std::vector<Direction> actions(2, Direction::Left);
+
+    for (int tick = 0; tick < 30; ++tick) {
+        batch.Step(actions);
+    }
+    int otherScore = batch.GetScore(1);
+    batch.ResetGame(0);
+
+    EXPECT_EQ(batch.GetScore(0), 0);
+    EXPECT_EQ(batch.GetPlayerPosition(0), (Vector2{GameConfig::PlayerStartX, GameConfig::PlayerStartY}));
+    EXPECT_EQ(batch.GetPelletCount(0), Map().GetInitialPelletCount());
+    EXPECT_EQ(batch.GetScore(1), otherScore);
+}
+
+TEST(BatchEnvironmentTest, ResetGame_ReplaysLikeFreshSeededEngine) {
+    // Both games of each seed frighten ghosts, so both draw from the generator
+    for (uint64_t seed : {1u, 24u, 25u}) {
+        std::mt19937 inputs(static_cast<uint32_t>(seed));
+        std::uniform_int_distribution<int> pick(0, 4);
+        BatchEnvironment batch(1, seed);
+        std::vector<Direction> actions(1);
+
+        // Play one whole game first so the generator is no longer fresh
+        for (int tick = 0; batch.GetState(0) == GameState::Running; ++tick) {
+            if (tick % 8 == 0) actions[0] = static_cast<Direction>(pick(inputs));
+            batch.Step(actions);
+        }
+        batch.ResetGame(0);
+
+        auto engine = CreateGameEngine(seed);
+        engine->StartNewGame();
+        ExpectSameState(*engine, batch, 0);
+        for (int tick = 0; tick < 100000 && engine->GetState() == GameState::Running; ++tick) {
+            if (tick % 8 == 0) actions[0] = static_cast<Direction>(pick(inputs));
+            engine->SetPlayerDirection(actions[0]);
+            engine->Update(batch.GetDeltaTime());
+            batch.Step(actions);
+            ExpectSameState(*engine, batch, 0);
+            if (HasFailure()) FAIL() << "Diverged at tick " << tick << " with seed " << seed;
+        }
+    }
+}
+
+TEST(BatchEnvironmentTest, FinishedGames_AreNotStepped) {
+    BatchEnvironment batch(1);
+    std::vector<Direction> actions(1, Direction::None);
+
+    while (batch.GetState(0) == GameState::Running) {
+        batch.Step(actions);
+    }
+    PlayerState before = batch.GetPlayerState(0);
+    batch.Step(actions);
+
+    EXPECT_EQ(batch.GetRunningCount(), 0u);
+    EXPECT_EQ(batch.GetPlayerState(0).Score, before.Score);
+    EXPECT_EQ(batch.GetPlayerState(0).Position, before.Position);
+}
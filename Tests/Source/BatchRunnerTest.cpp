@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include "BatchRunner.hpp"
+#include "GameConfig.hpp"
+#include "WorkStealingRange.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Pacman;
+
+namespace {
+
+    BatchRunConfig SmallConfig(unsigned threads) {
+        BatchRunConfig config;
+        config.GameCount = 24;
+        config.BaseSeed = 500;
+        config.ThreadCount = threads;
+        config.MaxTicksPerGame = 3000;
+        config.KeepResults = true;
+        return config;
+    }
+
+    AgentFactory RandomAgents() {
+        return [] { return std::make_unique<RandomAgent>(); };
+    }
+
+}
+
+TEST(WorkStealingRangeTest, PopAndSteal_SplitTheRange) {
+    WorkStealingRange range;
+    range.Reset(10, 20);
+
+    EXPECT_EQ(range.Pop(), 10u);
+    auto block = range.Steal();
+    ASSERT_TRUE(block);
+    EXPECT_EQ(block->Begin, 15u);
+    EXPECT_EQ(block->End, 20u);
+    EXPECT_EQ(range.GetRemaining(), 4u);
+
+    for (uint32_t expected = 11; expected < 15; ++expected) {
+        EXPECT_EQ(range.Pop(), expected);
+    }
+    EXPECT_FALSE(range.Pop());
+    EXPECT_FALSE(range.Steal());
+}
+
+TEST(WorkStealingRangeTest, ConcurrentThieves_TakeEveryIndexOnce) {
+    constexpr uint32_t Count = 200000;
+    WorkStealingRange range;
+    range.Reset(0, Count);
+    std::vector<std::atomic<int>> taken(Count);
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&] {
+            while (auto block = range.Steal()) {
+                for (uint32_t i = block->Begin; i < block->End; ++i) taken[i]++;
+            }
+        });
+    }
+    while (auto index = range.Pop()) taken[*index]++;
+    for (auto& thief : thieves) thief.join();
+
+    for (uint32_t i = 0; i < Count; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << "index " << i;
+    }
+}
+
+TEST(BatchRunnerTest, PlaysEveryGameOnce) {
+    BatchReport report = RunBatch(SmallConfig(3), RandomAgents());
+
+    EXPECT_EQ(report.Games, 24u);
+    EXPECT_EQ(report.Victories + report.GameOvers + report.TimedOut, 24u);
+    ASSERT_EQ(report.Workers.size(), 3u);
+    uint64_t workerGames = 0;
+    for (const WorkerReport& worker : report.Workers) workerGames += worker.Games;
+    EXPECT_EQ(workerGames, 24u);
+    for (size_t i = 0; i < report.Results.size(); ++i) {
+        EXPECT_EQ(report.Results[i].Seed, 500u + i);
+        EXPECT_GT(report.Results[i].Ticks, 0u);
+    }
+    EXPECT_GT(report.GamesPerSecond, 0.0);
+}
+
+TEST(BatchRunnerTest, Results_DoNotDependOnThreadCount) {
+    BatchReport single = RunBatch(SmallConfig(1), RandomAgents());
+    BatchReport several = RunBatch(SmallConfig(4), RandomAgents());
+
+    ASSERT_EQ(single.Results.size(), several.Results.size());
+    for (size_t i = 0; i < single.Results.size(); ++i) {
+        EXPECT_EQ(single.Results[i].Score, several.Results[i].Score) << "game " << i;
+        EXPECT_EQ(single.Results[i].Ticks, several.Results[i].Ticks) << "game " << i;
+        EXPECT_EQ(single.Results[i].Outcome, several.Results[i].Outcome) << "game " << i;
+        EXPECT_EQ(single.Results[i].Deaths, several.Results[i].Deaths) << "game " << i;
+    }
+    EXPECT_EQ(single.TotalScore, several.TotalScore);
+    EXPECT_EQ(single.DeathsByGhost, several.DeathsByGhost);
+}
+
+TEST(BatchRunnerTest, Results_MatchFreshSeededEngines) {
+    BatchRunConfig config = SmallConfig(2);
+    config.GameCount = 6;
+    BatchReport report = RunBatch(config, RandomAgents());
+
+    for (uint32_t i = 0; i < config.GameCount; ++i) {
+        uint64_t seed = config.BaseSeed + i;
+        auto engine = CreateGameEngine(seed);
+        engine->StartNewGame();
+        RandomAgent agent;
+        agent.BeginGame(seed);
+
+        uint32_t tick = 0;
+        int lives = engine->GetPlayerState().Lives;
+        while (tick < config.MaxTicksPerGame && engine->GetState() == GameState::Running) {
+            engine->SetPlayerDirection(agent.ChooseDirection(*engine, tick));
+            engine->Update(config.DeltaTime);
+            ++tick;
+        }
+        int deaths = report.Results[i].UnknownDeaths;
+        for (uint8_t d : report.Results[i].Deaths) deaths += d;
+
+        EXPECT_EQ(report.Results[i].Ticks, tick) << "game " << i;
+        EXPECT_EQ(report.Results[i].Score, engine->GetPlayerState().Score) << "game " << i;
+        EXPECT_EQ(report.Results[i].Outcome, engine->GetState()) << "game " << i;
+        EXPECT_EQ(deaths, lives - engine->GetPlayerState().Lives) << "game " << i;
+    }
+}
+
+TEST(BatchRunnerTest, IdleAgent_LosesEveryLifeToGhosts) {
+    BatchRunConfig config = SmallConfig(2);
+    config.GameCount = 4;
+    config.MaxTicksPerGame = 100000;
+    BatchReport report = RunBatch(config, [] {
+        return std::make_unique<ScriptedAgent>(std::vector<Direction>{Direction::None});
+    });
+
+    EXPECT_EQ(report.GameOvers, 4u);
+    uint64_t deaths = 0;
+    for (uint64_t d : report.DeathsByGhost) deaths += d;
+    EXPECT_EQ(deaths, 4u * GameConfig::StartingLives);
+    EXPECT_EQ(report.UnknownDeaths, 0u);
+}
+
+TEST(BatchRunnerTest, DeathsPerGhost_SumToLivesLost) {
+    // These seeds each lose a life in the tick frightened mode ends
+    for (uint64_t seed : {300u, 2602u, 4414u}) {
+        BatchRunConfig config = SmallConfig(1);
+        config.GameCount = 1;
+        config.BaseSeed = seed;
+        config.MaxTicksPerGame = 100000;
+        BatchReport report = RunBatch(config, RandomAgents());
+
+        ASSERT_EQ(report.Results.size(), 1u);
+        const GameResult& result = report.Results[0];
+        int deaths = result.UnknownDeaths;
+        for (uint8_t d : result.Deaths) deaths += d;
+        EXPECT_EQ(result.Outcome, GameState::GameOver) << "seed " << seed;
+        EXPECT_EQ(deaths, GameConfig::StartingLives) << "seed " << seed;
+        EXPECT_EQ(result.UnknownDeaths, 0) << "seed " << seed;
+    }
+}
+
+TEST(BatchRunnerTest, GreedyAgent_ClearsMoreOfTheMazeThanRandom) {
+    BatchRunConfig config = SmallConfig(2);
+    config.MaxTicksPerGame = 10000;
+    BatchReport random = RunBatch(config, RandomAgents());
+    BatchReport greedy = RunBatch(config, [] { return std::make_unique<GreedyAgent>(); });
+
+    EXPECT_GT(greedy.TotalScore, 2 * random.TotalScore);
+    EXPECT_GT(greedy.Victories, 0u);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "Bitboard.hpp"
+#include "Map.hpp"
+
+#include <vector>
+
+using namespace Pacman;
+
+TEST(BitboardTest, SetTestReset) {
+    Bitboard board;
+    EXPECT_FALSE(board.Any());
+
+    board.Set(0);
+    board.Set(63);
+    board.Set(64);
+    board.Set(Bitboard::BitCount - 1);
+    EXPECT_TRUE(board.Test(63));
+    EXPECT_TRUE(board.Test(64));
+    EXPECT_FALSE(board.Test(1));
+    EXPECT_EQ(board.Count(), 4);
+
+    board.Reset(63);
+    EXPECT_FALSE(board.Test(63));
+    EXPECT_EQ(board.Count(), 3);
+}
+
+TEST(BitboardTest, ForEachSetBit_VisitsInAscendingOrder) {
+    Bitboard board;
+    std::vector<int> expected = {3, 64, 130, Bitboard::BitCount - 1};
+    for (int index : expected) board.Set(index);
+
+    std::vector<int> visited;
+    board.ForEachSetBit([&](int index) { visited.push_back(index); });
+    EXPECT_EQ(visited, expected);
+}
+
+TEST(BitboardTest, Map_PelletLayersMatchTiles) {
+    Map map;
+    int pellets = 0;
+    for (int y = 0; y < map.GetHeight(); ++y) {
+        for (int x = 0; x < map.GetWidth(); ++x) {
+            TileType tile = map.GetTileAt({x, y});
+            int index = y * map.GetWidth() + x;
+            EXPECT_EQ(map.GetPellets().Test(index), tile == TileType::Pellet);
+            EXPECT_EQ(map.GetPowerPellets().Test(index), tile == TileType::PowerPellet);
+            EXPECT_EQ(map.GetWalls().Test(index), tile == TileType::Wall);
+            if (tile == TileType::Pellet || tile == TileType::PowerPellet) ++pellets;
+        }
+    }
+    EXPECT_EQ(map.GetPelletCount(), pellets);
+    EXPECT_EQ(map.GetPelletPositions().size(), static_cast<size_t>(pellets));
+}
+
+TEST(BitboardTest, Map_EatingPelletUpdatesCountAndPositions) {
+    Map map;
+    Vector2 first = map.GetPelletPositions().front();
+    int count = map.GetPelletCount();
+
+    map.SetTileAt(first, TileType::Path);
+    EXPECT_EQ(map.GetPelletCount(), count - 1);
+    EXPECT_EQ(map.GetTileAt(first), TileType::Path);
+    EXPECT_NE(map.GetPelletPositions().front(), first);
+}
+
+TEST(BitboardTest, Map_PelletCountMatchesPopcountAfterEdits) {
+    Map map;
+    map.SetTileAt({1, 1}, TileType::Path);
+    map.SetTileAt({1, 3}, TileType::Pellet);
+    map.SetTileAt({0, 0}, TileType::PowerPellet);
+    map.SetTileAt({0, 0}, TileType::PowerPellet);
+
+    EXPECT_EQ(map.GetPelletCount(), map.GetPellets().Count() + map.GetPowerPellets().Count());
+}
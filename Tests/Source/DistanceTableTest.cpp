@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "DistanceTable.hpp"
+#include "IGameEngine.hpp"
+
+#include <random>
+
+using namespace Pacman;
+
+class DistanceTableTest : public ::testing::Test {
+protected:
+    const MazeGraph& graph = DefaultLevelData.Graph;
+    DistanceTable player{DefaultLevelData, MazeGraph::Mover::Player};
+    DistanceTable eaten{DefaultLevelData, MazeGraph::Mover::EatenGhost};
+};
+
+TEST_F(DistanceTableTest, SelfAndAdjacentDistances) {
+    Vector2 start = {GameConfig::PlayerStartX, GameConfig::PlayerStartY};
+    EXPECT_EQ(player.GetDistance(start, start), 0);
+    EXPECT_EQ(player.GetDistance(start, start + Vector2{-1, 0}), 1);
+    EXPECT_EQ(player.GetNextHop(start, start), Direction::None);
+    EXPECT_EQ(player.GetNextHop(start, start + Vector2{-1, 0}), Direction::Left);
+}
+
+TEST_F(DistanceTableTest, TunnelWrapIsOneStep) {
+    EXPECT_EQ(player.GetDistance({0, 14}, {MazeGraph::Width - 1, 14}), 1);
+    EXPECT_EQ(player.GetNextHop({0, 14}, {MazeGraph::Width - 1, 14}), Direction::Left);
+}
+
+TEST_F(DistanceTableTest, WallsAndGhostHouse_AreUnreachableForPlayer) {
+    Vector2 start = {GameConfig::PlayerStartX, GameConfig::PlayerStartY};
+    EXPECT_EQ(player.GetDistance(start, {0, 0}), DistanceTable::Unreachable);
+    EXPECT_EQ(player.GetDistance(start, {GameConfig::GhostHouseX, GameConfig::GhostHouseY}),
+              DistanceTable::Unreachable);
+    EXPECT_NE(eaten.GetDistance({1, 1}, {GameConfig::GhostHouseX, GameConfig::GhostHouseY}),
+              DistanceTable::Unreachable);
+    EXPECT_EQ(player.GetDistance(start, {-1, 5}), DistanceTable::Unreachable);
+}
+
+TEST_F(DistanceTableTest, PlayerStart_CanOnlyBeLeft) {
+    Vector2 start = {GameConfig::PlayerStartX, GameConfig::PlayerStartY};
+    EXPECT_EQ(player.GetDistance(start, start + Vector2{-1, 0}), 1);
+    EXPECT_EQ(player.GetDistance(start + Vector2{-1, 0}, start), DistanceTable::Unreachable);
+}
+
+TEST_F(DistanceTableTest, PlayerDistances_AreSymmetric) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, MazeGraph::TileCount - 1);
+    int start = MazeGraph::ToIndex({GameConfig::PlayerStartX, GameConfig::PlayerStartY});
+    for (int i = 0; i < 2000; ++i) {
+        int a = pick(rng);
+        int b = pick(rng);
+        if (a == start || b == start) continue;
+        EXPECT_EQ(player.GetDistance(a, b), player.GetDistance(b, a));
+    }
+}
+
+TEST_F(DistanceTableTest, FollowingNextHops_ReachesTargetInDistanceSteps) {
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> pick(0, MazeGraph::TileCount - 1);
+    int checked = 0;
+    while (checked < 500) {
+        int from = pick(rng);
+        int to = pick(rng);
+        int distance = eaten.GetDistance(from, to);
+        if (distance == DistanceTable::Unreachable) continue;
+
+        int tile = from;
+        for (int step = distance; step > 0; --step) {
+            Direction hop = eaten.GetNextHop(tile, to);
+            ASSERT_NE(hop, Direction::None);
+            ASSERT_TRUE(graph.GetEatenExits(tile) & MazeGraph::ExitBit(hop));
+            tile = graph.GetNeighbor(tile, hop);
+            ASSERT_EQ(eaten.GetDistance(tile, to), step - 1);
+        }
+        EXPECT_EQ(tile, to);
+        ++checked;
+    }
+}
+
+TEST(DistanceTableEngineTest, TableIsSharedBetweenEngines) {
+    auto first = CreateGameEngine(1);
+    auto second = CreateGameEngine(2);
+    auto table = first->GetDistanceTable(MazeGraph::Mover::Player);
+
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table, second->GetDistanceTable(MazeGraph::Mover::Player));
+    EXPECT_EQ(table, first->Clone()->GetDistanceTable(MazeGraph::Mover::Player));
+    EXPECT_NE(table, first->GetDistanceTable(MazeGraph::Mover::Ghost));
+}
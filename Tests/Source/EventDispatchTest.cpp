@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "IGameEngine.hpp"
+#include "IEventListener.hpp"
+#include "IFrameListener.hpp"
+
+#include <array>
+#include <vector>
+
+using namespace Pacman;
+
+namespace {
+
+    /// @brief Listener doing the kind of work a renderer does, without allocating
+    class RecordingListener : public IEventListener {
+    public:
+        void OnTileUpdated(const TileUpdate& update) override { lastTile = update.Position; ++tiles; }
+        void OnPlayerStateChanged(const PlayerState& state) override { player = state.Position; }
+        void OnGameStateChanged(GameState state) override { gameState = state; }
+        void OnGhostsUpdated(std::span<const GhostState> ghosts) override {
+            for (size_t i = 0; i < ghosts.size() && i < positions.size(); ++i) {
+                positions[i] = ghosts[i].Position;
+            }
+            ++ghostUpdates;
+        }
+        void OnGhostModeChanged(GhostMode mode) override { ghostMode = mode; }
+
+        std::array<Vector2, 4> positions{};
+        Vector2 lastTile{0, 0};
+        Vector2 player{0, 0};
+        GameState gameState = GameState::Paused;
+        GhostMode ghostMode = GhostMode::Scatter;
+        int tiles = 0;
+        int ghostUpdates = 0;
+    };
+
+    /// @brief Frame listener that keeps a copy of everything it was given
+    class FrameRecorder : public IFrameListener {
+    public:
+        void OnFrame(const FrameDelta& frame) override {
+            ++frames;
+            eatenTiles.insert(eatenTiles.end(), frame.EatenTiles.begin(), frame.EatenTiles.end());
+            modeTransitions.insert(modeTransitions.end(), frame.ModeTransitions.begin(), frame.ModeTransitions.end());
+            last = frame;
+            lastGhosts.assign(frame.Ghosts.begin(), frame.Ghosts.end());
+            if (frame.StateChanged) states.push_back(frame.State);
+        }
+
+        int frames = 0;
+        std::vector<TileUpdate> eatenTiles;
+        std::vector<GhostMode> modeTransitions;
+        std::vector<GameState> states;
+        std::vector<GhostState> lastGhosts;
+        FrameDelta last;
+    };
+
+}
+
+TEST(EventDispatchTest, OnGhostsUpdated_ViewsAllGhosts) {
+    auto engine = CreateGameEngine(1);
+    auto listener = std::make_shared<RecordingListener>();
+    engine->AddListener(listener);
+    engine->StartNewGame();
+
+    auto ghosts = engine->GetGhostStates();
+    ASSERT_EQ(ghosts.size(), listener->positions.size());
+    for (size_t i = 0; i < ghosts.size(); ++i) {
+        EXPECT_EQ(listener->positions[i], ghosts[i].Position);
+    }
+}
+
+TEST(EventDispatchTest, OnFrame_DeliveredOncePerUpdate) {
+    auto engine = CreateGameEngine(1);
+    auto recorder = std::make_shared<FrameRecorder>();
+    engine->AddFrameListener(recorder);
+    engine->StartNewGame();
+    ASSERT_EQ(recorder->frames, 1);
+
+    for (int tick = 0; tick < 100; ++tick) {
+        engine->Update(0.2f);
+    }
+    EXPECT_EQ(recorder->frames, 101);
+}
+
+TEST(EventDispatchTest, OnFrame_CarriesSameChangesAsIndividualEvents) {
+    class TileCollector : public RecordingListener {
+    public:
+        void OnTileUpdated(const TileUpdate& update) override { eaten.push_back(update.Position); }
+        void OnGhostModeChanged(GhostMode mode) override { modes.push_back(mode); }
+        std::vector<Vector2> eaten;
+        std::vector<GhostMode> modes;
+    };
+
+    auto engine = CreateGameEngine(3);
+    auto collector = std::make_shared<TileCollector>();
+    auto recorder = std::make_shared<FrameRecorder>();
+    engine->AddListener(collector);
+    engine->AddFrameListener(recorder);
+    engine->StartNewGame();
+
+    constexpr Direction moves[] = {Direction::Left, Direction::Up, Direction::Right, Direction::Down};
+    for (int tick = 0; tick < 3000 && engine->GetState() == GameState::Running; ++tick) {
+        engine->SetPlayerDirection(moves[(tick / 45) % 4]);
+        engine->Update(1.0f / 60.0f);
+    }
+
+    ASSERT_EQ(recorder->eatenTiles.size(), collector->eaten.size());
+    for (size_t i = 0; i < collector->eaten.size(); ++i) {
+        EXPECT_EQ(recorder->eatenTiles[i].Position, collector->eaten[i]);
+        EXPECT_EQ(recorder->eatenTiles[i].Type, TileType::Path);
+    }
+    // Frames also report the end of frightened mode, which has no individual event
+    EXPECT_GE(recorder->modeTransitions.size(), collector->modes.size());
+
+    PlayerState player = engine->GetPlayerState();
+    EXPECT_EQ(recorder->last.Player.Position, player.Position);
+    EXPECT_EQ(recorder->last.Player.Score, player.Score);
+    auto ghosts = engine->GetGhostStates();
+    ASSERT_EQ(recorder->lastGhosts.size(), ghosts.size());
+    for (size_t i = 0; i < ghosts.size(); ++i) {
+        EXPECT_EQ(recorder->lastGhosts[i].Position, ghosts[i].Position);
+    }
+}
+
+TEST(EventDispatchTest, OnFrame_ReportsGameStateChanges) {
+    auto engine = CreateGameEngine(1);
+    auto recorder = std::make_shared<FrameRecorder>();
+    engine->AddFrameListener(recorder);
+    engine->StartNewGame();
+
+    engine->SetPaused(true);
+    engine->Update(0.016f);
+    EXPECT_TRUE(recorder->last.StateChanged);
+    EXPECT_EQ(recorder->last.State, GameState::Paused);
+
+    engine->Update(0.016f);
+    EXPECT_FALSE(recorder->last.StateChanged);
+    EXPECT_FALSE(recorder->last.PlayerChanged);
+    EXPECT_TRUE(recorder->last.EatenTiles.empty());
+
+    std::vector<GameState> expected = {GameState::Running, GameState::Paused};
+    EXPECT_EQ(recorder->states, expected);
+}
+
+TEST(EventDispatchTest, RemoveFrameListener_StopsDelivery) {
+    auto engine = CreateGameEngine(1);
+    auto recorder = std::make_shared<FrameRecorder>();
+    engine->AddFrameListener(recorder);
+    engine->StartNewGame();
+    engine->RemoveFrameListener(recorder);
+    engine->Update(0.2f);
+
+    EXPECT_EQ(recorder->frames, 1);
+}
@@ -0,0 +1,361 @@
+#include <gtest/gtest.h>
+#include "IGameEngine.hpp"
+#include "IEventListener.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+using namespace Pacman;
+
+namespace {
+
+    /// @brief Listener that holds the engine inside Update until released
+    class BlockingListener : public IEventListener {
+    public:
+        void OnTileUpdated(const TileUpdate&) override {}
+        void OnPlayerStateChanged(const PlayerState&) override {}
+        void OnGameStateChanged(GameState) override {}
+
+        void OnGhostsUpdated(std::span<const GhostState>) override {
+            if (!armed) return;
+            entered = true;
+            while (!released) std::this_thread::yield();
+        }
+
+        std::atomic<bool> armed{false};
+        std::atomic<bool> entered{false};
+        std::atomic<bool> released{false};
+    };
+
+}
+
+class GameEngineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        engine = CreateGameEngine();
+        engine->StartNewGame();
+    }
+
+    std::shared_ptr<IGameEngine> engine;
+};
+
+TEST_F(GameEngineTest, SetPlayerDirection_AppliedOnNextUpdate) {
+    // The player starts facing left in a corridor; down only opens one tile later
+    engine->SetPlayerDirection(Direction::Down);
+    engine->Update(0.12f);
+    EXPECT_EQ(engine->GetPlayerState().Position, (Vector2{12, 26}));
+
+    engine->Update(0.12f);
+    EXPECT_EQ(engine->GetPlayerState().Position, (Vector2{12, 27}));
+    EXPECT_EQ(engine->GetPlayerState().CurrentDirection, Direction::Down);
+}
+
+TEST_F(GameEngineTest, TogglePaused_CountsEveryToggleBeforeUpdate) {
+    engine->TogglePaused();
+    engine->Update(0.01f);
+    EXPECT_EQ(engine->GetState(), GameState::Paused);
+
+    engine->TogglePaused();
+    engine->TogglePaused();
+    engine->Update(0.01f);
+    EXPECT_EQ(engine->GetState(), GameState::Paused);
+
+    engine->TogglePaused();
+    engine->Update(0.01f);
+    EXPECT_EQ(engine->GetState(), GameState::Running);
+
+    // A toggle after an explicit request flips that request
+    engine->SetPaused(false);
+    engine->TogglePaused();
+    engine->Update(0.01f);
+    EXPECT_EQ(engine->GetState(), GameState::Paused);
+}
+
+TEST_F(GameEngineTest, SetPlayerDirection_LatestValueWins) {
+    engine->SetPlayerDirection(Direction::Down);
+    engine->SetPlayerDirection(Direction::Left);
+    engine->Update(0.12f);
+    engine->Update(0.12f);
+
+    EXPECT_EQ(engine->GetPlayerState().CurrentDirection, Direction::Left);
+    EXPECT_EQ(engine->GetPlayerState().Position, (Vector2{11, 26}));
+}
+
+TEST_F(GameEngineTest, SetPaused_TakesEffectOnNextUpdate) {
+    engine->SetPaused(true);
+    engine->Update(0.016f);
+    EXPECT_EQ(engine->GetState(), GameState::Paused);
+
+    engine->SetPaused(false);
+    engine->Update(0.016f);
+    EXPECT_EQ(engine->GetState(), GameState::Running);
+}
+
+TEST_F(GameEngineTest, StartNewGame_DiscardsPendingInput) {
+    engine->SetPaused(true);
+    engine->StartNewGame();
+    engine->Update(0.016f);
+
+    EXPECT_EQ(engine->GetState(), GameState::Running);
+}
+
+TEST_F(GameEngineTest, SetPlayerDirection_DoesNotWaitForRunningUpdate) {
+    auto listener = std::make_shared<BlockingListener>();
+    engine->AddListener(listener);
+    listener->armed = true;
+
+    // A long step guarantees the ghosts move, and so notify, inside this Update
+    std::thread updater([this] { engine->Update(0.2f); });
+    while (!listener->entered) std::this_thread::yield();
+
+    auto submitted = std::async(std::launch::async, [this] {
+        engine->SetPlayerDirection(Direction::Right);
+        engine->SetPaused(true);
+    });
+    bool completedWhileBlocked =
+        submitted.wait_for(std::chrono::seconds(2)) == std::future_status::ready;
+
+    listener->released = true;
+    updater.join();
+    submitted.wait();
+
+    EXPECT_TRUE(completedWhileBlocked);
+}
+
+namespace {
+
+    void ExpectSameGame(const IGameEngine& expected, const IGameEngine& actual) {
+        EXPECT_EQ(expected.GetState(), actual.GetState());
+        EXPECT_EQ(expected.GetPelletCount(), actual.GetPelletCount());
+        EXPECT_EQ(expected.GetPlayerState().Position, actual.GetPlayerState().Position);
+        EXPECT_EQ(expected.GetPlayerState().Score, actual.GetPlayerState().Score);
+        EXPECT_EQ(expected.GetPlayerState().Lives, actual.GetPlayerState().Lives);
+
+        auto expectedGhosts = expected.GetGhostStates();
+        auto actualGhosts = actual.GetGhostStates();
+        ASSERT_EQ(expectedGhosts.size(), actualGhosts.size());
+        for (size_t i = 0; i < expectedGhosts.size(); ++i) {
+            EXPECT_EQ(expectedGhosts[i].Position, actualGhosts[i].Position);
+            EXPECT_EQ(expectedGhosts[i].CurrentDirection, actualGhosts[i].CurrentDirection);
+            EXPECT_EQ(expectedGhosts[i].IsFrightened, actualGhosts[i].IsFrightened);
+        }
+    }
+
+    void Play(IGameEngine& engine, int ticks) {
+        constexpr Direction moves[] = {Direction::Left, Direction::Up, Direction::Right, Direction::Down};
+        for (int tick = 0; tick < ticks; ++tick) {
+            engine.SetPlayerDirection(moves[(tick / 40) % 4]);
+            engine.Update(1.0f / 60.0f);
+        }
+    }
+
+}
+
+TEST_F(GameEngineTest, RestoreSnapshot_RewindsGame) {
+    Play(*engine, 120);
+    EngineSnapshot snapshot;
+    engine->SaveSnapshot(snapshot);
+    PlayerState saved = engine->GetPlayerState();
+    int savedPellets = engine->GetPelletCount();
+
+    Play(*engine, 300);
+    ASSERT_NE(engine->GetPelletCount(), savedPellets);
+
+    engine->RestoreSnapshot(snapshot);
+    EXPECT_EQ(engine->GetPlayerState().Position, saved.Position);
+    EXPECT_EQ(engine->GetPlayerState().Score, saved.Score);
+    EXPECT_EQ(engine->GetPelletCount(), savedPellets);
+    EXPECT_EQ(engine->GetPelletPositions().size(), static_cast<size_t>(savedPellets));
+}
+
+TEST_F(GameEngineTest, RestoreSnapshot_ReplaysIdentically) {
+    Play(*engine, 60);
+    EngineSnapshot snapshot;
+    engine->SaveSnapshot(snapshot);
+    auto other = CreateGameEngine();
+    other->RestoreSnapshot(snapshot);
+
+    for (int step = 0; step < 20 && engine->GetState() == GameState::Running; ++step) {
+        Play(*engine, 100);
+        Play(*other, 100);
+        ExpectSameGame(*engine, *other);
+    }
+}
+
+TEST_F(GameEngineTest, Clone_IsIndependentCopy) {
+    Play(*engine, 90);
+    auto clone = engine->Clone();
+    ExpectSameGame(*engine, *clone);
+
+    int pellets = engine->GetPelletCount();
+    Play(*clone, 200);
+    EXPECT_EQ(engine->GetPelletCount(), pellets);
+    EXPECT_NE(clone->GetPelletCount(), pellets);
+}
+
+TEST_F(GameEngineTest, Clone_KeepsQueuedInput) {
+    engine->SetPlayerDirection(Direction::Down);
+    engine->SetPaused(true);
+    auto clone = engine->Clone();
+
+    engine->Update(0.12f);
+    clone->Update(0.12f);
+    EXPECT_EQ(clone->GetState(), GameState::Paused);
+    ExpectSameGame(*engine, *clone);
+
+    engine->SetPaused(false);
+    clone = engine->Clone();
+    engine->Update(0.12f);
+    clone->Update(0.12f);
+    EXPECT_EQ(clone->GetPlayerState().Position, (Vector2{12, 26}));
+    ExpectSameGame(*engine, *clone);
+}
+
+TEST_F(GameEngineTest, Clone_DoesNotCopyListeners) {
+    auto listener = std::make_shared<BlockingListener>();
+    engine->AddListener(listener);
+    auto clone = engine->Clone();
+
+    // Armed listener would block forever if the clone notified it
+    listener->armed = true;
+    clone->Update(0.2f);
+    EXPECT_FALSE(listener->entered);
+}
+
+TEST(EngineSnapshotTest, IsPlainData) {
+    EXPECT_TRUE(std::is_trivially_copyable_v<EngineSnapshot>);
+    EXPECT_TRUE(std::is_standard_layout_v<EngineSnapshot>);
+}
+
+namespace {
+
+    void ExpectIdenticalSnapshots(const EngineSnapshot& expected, const EngineSnapshot& actual) {
+        EXPECT_EQ(expected.Board.GetPellets(), actual.Board.GetPellets());
+        EXPECT_EQ(expected.Board.GetPowerPellets(), actual.Board.GetPowerPellets());
+        EXPECT_EQ(expected.Player.Position, actual.Player.Position);
+        EXPECT_EQ(expected.Player.Score, actual.Player.Score);
+        EXPECT_EQ(expected.Player.Lives, actual.Player.Lives);
+        for (size_t i = 0; i < expected.Ghosts.size(); ++i) {
+            EXPECT_EQ(expected.Ghosts[i].Position, actual.Ghosts[i].Position);
+            EXPECT_EQ(expected.Ghosts[i].CurrentDirection, actual.Ghosts[i].CurrentDirection);
+            EXPECT_EQ(expected.Ghosts[i].IsFrightened, actual.Ghosts[i].IsFrightened);
+        }
+        EXPECT_EQ(expected.ModeController.GetCurrentMode(), actual.ModeController.GetCurrentMode());
+        EXPECT_EQ(expected.ModeController.GetFrightenedTimeRemaining(), actual.ModeController.GetFrightenedTimeRemaining());
+        EXPECT_EQ(expected.PlayerStepTimer, actual.PlayerStepTimer);
+        EXPECT_EQ(expected.GhostStepTimer, actual.GhostStepTimer);
+        EXPECT_EQ(expected.Seed, actual.Seed);
+        EXPECT_EQ(expected.Rng, actual.Rng);
+    }
+
+    /// @brief Play a whole game with pseudo-random inputs, snapshotting every tick
+    std::vector<EngineSnapshot> RecordGame(uint64_t seed, uint32_t inputs = 7, bool customGhostAIs = false) {
+        auto engine = CreateGameEngine(seed);
+        if (customGhostAIs) {
+            for (auto type : {GhostType::Red, GhostType::Pink, GhostType::Blue, GhostType::Orange}) {
+                engine->SetGhostAI(type, CreateGhostAI(type));
+            }
+        }
+        engine->StartNewGame();
+        std::vector<EngineSnapshot> frames;
+        while (engine->GetState() == GameState::Running && frames.size() < 50000) {
+            inputs = inputs * 1664525u + 1013904223u;
+            engine->SetPlayerDirection(static_cast<Direction>(inputs >> 30));
+            engine->Update(1.0f / 60.0f);
+            engine->SaveSnapshot(frames.emplace_back());
+        }
+        return frames;
+    }
+
+}
+
+TEST(GameEngineSeedTest, CreateGameEngine_KeepsSeed) {
+    EXPECT_EQ(CreateGameEngine(42)->GetSeed(), 42u);
+}
+
+TEST(GameEngineSeedTest, SameSeedAndInputs_AreBitIdentical) {
+    std::vector<EngineSnapshot> first = RecordGame(99);
+    std::vector<EngineSnapshot> second = RecordGame(99);
+
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t tick = 0; tick < first.size(); ++tick) {
+        ExpectIdenticalSnapshots(first[tick], second[tick]);
+        if (HasFailure()) FAIL() << "Diverged at tick " << tick;
+    }
+}
+
+TEST(GameEngineSeedTest, StartNewGame_RestartsRandomSequence) {
+    auto engine = CreateGameEngine(5);
+    engine->StartNewGame();
+    EngineSnapshot fresh;
+    engine->SaveSnapshot(fresh);
+
+    Play(*engine, 600);
+    engine->StartNewGame();
+    EngineSnapshot restarted;
+    engine->SaveSnapshot(restarted);
+
+    EXPECT_EQ(fresh.Rng, restarted.Rng);
+}
+
+TEST(GameEngineSeedTest, DifferentSeeds_DivergeOnceGhostsAreFrightened) {
+    // Only frightened ghosts draw random numbers, so try input streams until one eats a power pellet
+    bool diverged = false;
+    for (uint32_t inputs = 1; inputs <= 16 && !diverged; ++inputs) {
+        std::vector<EngineSnapshot> first = RecordGame(1, inputs);
+        std::vector<EngineSnapshot> second = RecordGame(2, inputs);
+
+        diverged = first.size() != second.size();
+        for (size_t tick = 0; !diverged && tick < first.size(); ++tick) {
+            diverged = first[tick].Ghosts[0].Position != second[tick].Ghosts[0].Position ||
+                       first[tick].Player.Score != second[tick].Player.Score;
+        }
+    }
+    EXPECT_TRUE(diverged);
+}
+
+namespace {
+
+    /// @brief Chases a fixed tile and counts how often it is asked
+    class FixedTargetAI : public IGhost {
+    public:
+        Vector2 CalculateChaseTarget(const GhostState&, const PlayerState&, const Vector2&) const override {
+            ++calls;
+            return {1, 1};
+        }
+        Vector2 GetScatterTarget() const override { return {0, 0}; }
+        GhostType GetGhostType() const override { return GhostType::Red; }
+
+        mutable std::atomic<int> calls{0};
+    };
+
+}
+
+TEST(GameEngineGhostAITest, BuiltInRulesAsCustomAIs_PlayIdentically) {
+    std::vector<EngineSnapshot> builtIn = RecordGame(3);
+    std::vector<EngineSnapshot> custom = RecordGame(3, 7, true);
+
+    ASSERT_EQ(builtIn.size(), custom.size());
+    for (size_t tick = 0; tick < builtIn.size(); ++tick) {
+        ExpectIdenticalSnapshots(builtIn[tick], custom[tick]);
+        if (HasFailure()) FAIL() << "Diverged at tick " << tick;
+    }
+}
+
+TEST(GameEngineGhostAITest, SetGhostAI_ReplacesAndRestoresChaseRule) {
+    auto engine = CreateGameEngine(1);
+    auto ai = std::make_shared<FixedTargetAI>();
+    engine->SetGhostAI(GhostType::Red, ai);
+    engine->StartNewGame();
+
+    // The first scatter wave lasts seven seconds
+    Play(*engine, 600);
+    EXPECT_GT(ai->calls.load(), 0);
+
+    engine->SetGhostAI(GhostType::Red, nullptr);
+    int callsBefore = ai->calls.load();
+    Play(*engine, 600);
+    EXPECT_EQ(ai->calls.load(), callsBefore);
+}
@@ -10,6 +10,7 @@ public:
     MOCK_METHOD(void, StartNewGame, (), (override));
     MOCK_METHOD(void, Update, (float deltaTime), (override));
     MOCK_METHOD(void, SetPaused, (bool isPaused), (override));
+    MOCK_METHOD(void, TogglePaused, (), (override));
     MOCK_METHOD(void, SetPlayerDirection, (Direction direction), (override));
 
     MOCK_METHOD(GameState, GetState, (), (const, override));
@@ -20,9 +21,20 @@ public:
     MOCK_METHOD(int, GetPelletCount, (), (const, override));
     MOCK_METHOD(std::vector<GhostState>, GetGhostStates, (), (const, override));
     MOCK_METHOD(GhostMode, GetGlobalGhostMode, (), (const, override));
+    MOCK_METHOD(void, SaveSnapshot, (EngineSnapshot& snapshot), (const, override));
+    MOCK_METHOD(bool, RestoreSnapshot, (const EngineSnapshot& snapshot), (override));
+    MOCK_METHOD(std::shared_ptr<IGameEngine>, Clone, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<const DistanceTable>, GetDistanceTable, (MazeGraph::Mover mover), (const, override));
+    MOCK_METHOD(bool, LoadLevel, (std::shared_ptr<const LevelPack> pack, uint32_t index), (override));
+    MOCK_METHOD(uint32_t, GetLevelIndex, (), (const, override));
+    MOCK_METHOD(void, SetGhostAI, (GhostType type, std::shared_ptr<const IGhost> ai), (override));
+    MOCK_METHOD(void, SetKeyframeInterval, (uint32_t ticks), (override));
+    MOCK_METHOD(uint64_t, GetSeed, (), (const, override));
 
     MOCK_METHOD(void, AddListener, (std::shared_ptr<IEventListener> listener), (override));
     MOCK_METHOD(void, RemoveListener, (std::shared_ptr<IEventListener> listener), (override));
+    MOCK_METHOD(void, AddFrameListener, (std::shared_ptr<IFrameListener> listener), (override));
+    MOCK_METHOD(void, RemoveFrameListener, (std::shared_ptr<IFrameListener> listener), (override));
 };
 
 class GameScreenTest : public ::testing::Test {
@@ -478,3 +490,83 @@ TEST_F(GameScreenTest, RapidGameStateChanges_DoesNotCrash) {
         EXPECT_NO_THROW(gameScreen->OnGameStateChanged(states[i % 4]));
     }
 }
+
+TEST_F(GameScreenTest, Render_AfterGameStarted_DoesNotCrash) {
+    using ::testing::Return;
+    ON_CALL(*mockEngine, GetMapSize()).WillByDefault(Return(Vector2{4, 3}));
+    ON_CALL(*mockEngine, GetTileAt(Vector2{1, 1})).WillByDefault(Return(TileType::GhostDoor));
+    gameScreen->SetGameEngine(mockEngine);
+    gameScreen->Render(window);
+
+    InputLogEntry entry;
+    entry.Type = InputLogType::GameStarted;
+    gameScreen->OnInputLogged(entry);
+
+    EXPECT_NO_THROW(gameScreen->Render(window));
+}
+
+TEST_F(GameScreenTest, Render_ReadsTilesOnlyWhenAGameStarts) {
+    using ::testing::_;
+    using ::testing::Return;
+    ON_CALL(*mockEngine, GetMapSize()).WillByDefault(Return(Vector2{4, 3}));
+    ON_CALL(*mockEngine, GetTileAt(_)).WillByDefault(Return(TileType::Pellet));
+    EXPECT_CALL(*mockEngine, GetTileAt(_)).Times(2 * 4 * 3);
+    gameScreen->SetGameEngine(mockEngine);
+
+    for (int i = 0; i < 10; ++i) {
+        gameScreen->OnTileUpdated({Vector2{i % 4, i % 3}, TileType::Path});
+        gameScreen->Render(window);
+    }
+
+    InputLogEntry entry;
+    entry.Type = InputLogType::GameStarted;
+    gameScreen->OnInputLogged(entry);
+    gameScreen->Render(window);
+    gameScreen->Render(window);
+}
+
+TEST_F(GameScreenTest, Render_FrightenedWarning_DoesNotCrash) {
+    std::vector<GhostState> ghosts(4);
+    ghosts[0].IsFrightened = true;
+    ghosts[1].IsEaten = true;
+    ghosts[2].CurrentDirection = Direction::Up;
+    gameScreen->OnGhostsUpdated(ghosts);
+    gameScreen->OnGameStateChanged(GameState::Running);
+    gameScreen->OnGhostModeChanged(GhostMode::Frightened);
+
+    // Past the start of the warning at ~60 frames per second
+    for (int i = 0; i < 300; ++i) {
+        EXPECT_NO_THROW(gameScreen->Render(window));
+    }
+
+    gameScreen->OnGhostModeChanged(GhostMode::Chase);
+    EXPECT_NO_THROW(gameScreen->Render(window));
+}
+
+TEST_F(GameScreenTest, Render_HudAcrossStateChanges_DoesNotCrash) {
+    gameScreen->LoadAssets("assets");
+    PlayerState state;
+    for (GameState gameState : {GameState::Running, GameState::Paused, GameState::Running,
+                                GameState::GameOver, GameState::Victory}) {
+        gameScreen->OnGameStateChanged(gameState);
+        for (int i = 0; i < 3; ++i) {
+            state.Score += 10;
+            gameScreen->OnPlayerStateChanged(state);
+            EXPECT_NO_THROW(gameScreen->Render(window));
+        }
+    }
+}
+
+TEST_F(GameScreenTest, Render_AfterLevelLoaded_RereadsTiles) {
+    using ::testing::_;
+    using ::testing::Return;
+    ON_CALL(*mockEngine, GetMapSize()).WillByDefault(Return(Vector2{4, 3}));
+    ON_CALL(*mockEngine, GetTileAt(_)).WillByDefault(Return(TileType::Pellet));
+    EXPECT_CALL(*mockEngine, GetTileAt(_)).Times(2 * 4 * 3);
+    gameScreen->SetGameEngine(mockEngine);
+    gameScreen->Render(window);
+
+    gameScreen->OnLevelLoaded(1);
+    gameScreen->Render(window);
+    gameScreen->Render(window);
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "GameTypes.hpp"
 
+#include <type_traits>
+
 using namespace Pacman;
 
 TEST(DirectionTest, GetDirectionDelta_Up) {
@@ -229,7 +231,6 @@ TEST(GhostStateTest, DefaultConstruction) {
     EXPECT_FALSE(state.IsEaten);
     EXPECT_EQ(state.Type, GhostType::Red);
     EXPECT_EQ(state.Mode, GhostMode::Scatter);
-    EXPECT_TRUE(state.Name.empty());
 }
 
 TEST(GhostStateTest, CustomValues) {
@@ -240,7 +241,6 @@ TEST(GhostStateTest, CustomValues) {
     state.IsEaten = false;
     state.Type = GhostType::Pink;
     state.Mode = GhostMode::Chase;
-    state.Name = "Pinky";
     state.TargetTile = Vector2{20, 25};
     state.ScatterTarget = Vector2{2, -3};
 
@@ -251,7 +251,6 @@ TEST(GhostStateTest, CustomValues) {
     EXPECT_FALSE(state.IsEaten);
     EXPECT_EQ(state.Type, GhostType::Pink);
     EXPECT_EQ(state.Mode, GhostMode::Chase);
-    EXPECT_EQ(state.Name, "Pinky");
     EXPECT_EQ(state.TargetTile.X, 20);
     EXPECT_EQ(state.TargetTile.Y, 25);
     EXPECT_EQ(state.ScatterTarget.X, 2);
@@ -283,3 +282,18 @@ TEST(EnumTest, TileTypeValues) {
     EXPECT_NE(TileType::Wall, TileType::Empty);
     EXPECT_NE(TileType::Wall, TileType::GhostDoor);
 }
+
+TEST(GhostStateTest, IsCompactPlainData) {
+    EXPECT_TRUE(std::is_trivially_copyable_v<GhostState>);
+    EXPECT_TRUE(std::is_trivially_copyable_v<PlayerState>);
+    // All four ghosts fit in two 64-byte cache lines
+    EXPECT_EQ(4 * sizeof(GhostState), 128u);
+    EXPECT_LE(sizeof(PlayerState), 20u);
+}
+
+TEST(GhostStateTest, GetGhostName_ForEachType) {
+    EXPECT_EQ(GetGhostName(GhostType::Red), "Red");
+    EXPECT_EQ(GetGhostName(GhostType::Pink), "Pink");
+    EXPECT_EQ(GetGhostName(GhostType::Blue), "Blue");
+    EXPECT_EQ(GetGhostName(GhostType::Orange), "Orange");
+}
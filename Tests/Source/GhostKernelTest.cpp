@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "GhostKernel.hpp"
+#include "GhostStrategies.hpp"
+#include "LevelData.hpp"
+
+#include <climits>
+#include <random>
+#include <vector>
+
+using namespace Pacman;
+
+namespace {
+
+    /// @brief Random lanes for one ghost type, with outputs for each SIMD level
+    struct Lanes {
+        std::vector<int16_t> GhostX, GhostY, Exits, Chase;
+        std::vector<int16_t> PlayerX, PlayerY, PlayerDirection, BlinkyX, BlinkyY;
+        std::vector<int16_t> TargetX, TargetY, NewDirection;
+
+        GhostKernelBatch MakeBatch(GhostType type) {
+            GhostKernelBatch batch;
+            batch.Type = type;
+            batch.ScatterTarget = DefaultLevelData.ScatterTargets[static_cast<int>(type)];
+            batch.Count = GhostX.size();
+            batch.GhostX = GhostX.data();
+            batch.GhostY = GhostY.data();
+            batch.Exits = Exits.data();
+            batch.Chase = Chase.data();
+            batch.PlayerX = PlayerX.data();
+            batch.PlayerY = PlayerY.data();
+            batch.PlayerDirection = PlayerDirection.data();
+            batch.BlinkyX = BlinkyX.data();
+            batch.BlinkyY = BlinkyY.data();
+            TargetX.assign(batch.Count, -1);
+            TargetY.assign(batch.Count, -1);
+            NewDirection.assign(batch.Count, -1);
+            batch.TargetX = TargetX.data();
+            batch.TargetY = TargetY.data();
+            batch.NewDirection = NewDirection.data();
+            return batch;
+        }
+    };
+
+    /// @brief Lanes on tiles a ghost can stand on, with the exit mask GameEngine would use
+    Lanes MakeRandomLanes(std::size_t count, uint32_t seed) {
+        const MazeGraph& graph = DefaultLevelData.Graph;
+        std::vector<int> ghostTiles;
+        std::vector<int> playerTiles;
+        for (int tile = 0; tile < MazeGraph::TileCount; ++tile) {
+            if (graph.GetGhostExits(tile)) ghostTiles.push_back(tile);
+            if (graph.GetPlayerExits(tile)) playerTiles.push_back(tile);
+        }
+        // Both ends of the side tunnel
+        ghostTiles.push_back(MazeGraph::ToIndex({0, 14}));
+        ghostTiles.push_back(MazeGraph::ToIndex({MazeGraph::Width - 1, 14}));
+
+        std::mt19937 rng(seed);
+        auto pick = [&rng](const std::vector<int>& tiles) {
+            return MazeGraph::ToPosition(tiles[std::uniform_int_distribution<std::size_t>(0, tiles.size() - 1)(rng)]);
+        };
+        std::uniform_int_distribution<int> direction(0, 4);
+
+        Lanes lanes;
+        for (std::size_t i = 0; i < count; ++i) {
+            Vector2 ghost = pick(ghostTiles);
+            Vector2 player = pick(playerTiles);
+            Vector2 blinky = pick(ghostTiles);
+            auto current = static_cast<Direction>(direction(rng));
+            uint8_t exits = graph.GetGhostExits(MazeGraph::ToIndex(ghost)) &
+                            ~MazeGraph::ExitBit(GetOppositeDirection(current));
+
+            lanes.GhostX.push_back(static_cast<int16_t>(ghost.X));
+            lanes.GhostY.push_back(static_cast<int16_t>(ghost.Y));
+            lanes.Exits.push_back(exits);
+            lanes.Chase.push_back(static_cast<int16_t>(rng() % 4 != 0));
+            lanes.PlayerX.push_back(static_cast<int16_t>(player.X));
+            lanes.PlayerY.push_back(static_cast<int16_t>(player.Y));
+            lanes.PlayerDirection.push_back(static_cast<int16_t>(direction(rng)));
+            lanes.BlinkyX.push_back(static_cast<int16_t>(blinky.X));
+            lanes.BlinkyY.push_back(static_cast<int16_t>(blinky.Y));
+        }
+        return lanes;
+    }
+
+    constexpr GhostType AllTypes[] = {GhostType::Red, GhostType::Pink, GhostType::Blue, GhostType::Orange};
+
+}
+
+TEST(GhostKernelTest, Scalar_MatchesEngineRules) {
+    const MazeGraph& graph = DefaultLevelData.Graph;
+    for (GhostType type : AllTypes) {
+        Lanes lanes = MakeRandomLanes(2000, 1 + static_cast<uint32_t>(type));
+        GhostKernelBatch batch = lanes.MakeBatch(type);
+        RunGhostKernel(batch, SimdLevel::Scalar);
+
+        for (std::size_t i = 0; i < batch.Count; ++i) {
+            GhostState ghost{};
+            ghost.Position = {lanes.GhostX[i], lanes.GhostY[i]};
+            ghost.ScatterTarget = batch.ScatterTarget;
+            PlayerState player{};
+            player.Position = {lanes.PlayerX[i], lanes.PlayerY[i]};
+            player.CurrentDirection = static_cast<Direction>(lanes.PlayerDirection[i]);
+            Vector2 target = lanes.Chase[i]
+                ? CalculateChaseTarget(MakeGhostStrategy(type), ghost, player, {lanes.BlinkyX[i], lanes.BlinkyY[i]})
+                : batch.ScatterTarget;
+
+            // Neighbors come from the MazeGraph here, as in GameEngine::ChooseGhostDirection
+            Direction expected = Direction::None;
+            int bestDistSq = INT_MAX;
+            for (Direction dir : {Direction::Up, Direction::Left, Direction::Down, Direction::Right}) {
+                if (!(lanes.Exits[i] & MazeGraph::ExitBit(dir))) continue;
+                Vector2 next = MazeGraph::ToPosition(graph.GetNeighbor(MazeGraph::ToIndex(ghost.Position), dir));
+                int distSq = next.DistanceSquared(target);
+                if (distSq < bestDistSq) {
+                    bestDistSq = distSq;
+                    expected = dir;
+                }
+            }
+
+            ASSERT_EQ(Vector2(lanes.TargetX[i], lanes.TargetY[i]), target) << "lane " << i;
+            ASSERT_EQ(static_cast<Direction>(lanes.NewDirection[i]), expected) << "lane " << i;
+        }
+    }
+}
+
+TEST(GhostKernelTest, EverySimdLevel_MatchesScalar) {
+    // Odd count so every level also runs its leftover lanes
+    constexpr std::size_t Count = 1001;
+    for (GhostType type : AllTypes) {
+        Lanes lanes = MakeRandomLanes(Count, 100 + static_cast<uint32_t>(type));
+        RunGhostKernel(lanes.MakeBatch(type), SimdLevel::Scalar);
+        Lanes expected = lanes;
+
+        for (SimdLevel level : {SimdLevel::Sse2, SimdLevel::Avx2}) {
+            RunGhostKernel(lanes.MakeBatch(type), level);
+            EXPECT_EQ(lanes.TargetX, expected.TargetX);
+            EXPECT_EQ(lanes.TargetY, expected.TargetY);
+            EXPECT_EQ(lanes.NewDirection, expected.NewDirection);
+        }
+    }
+}
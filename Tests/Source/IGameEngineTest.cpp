@@ -11,7 +11,7 @@ public:
     MOCK_METHOD(void, OnTileUpdated, (const TileUpdate& update), (override));
     MOCK_METHOD(void, OnPlayerStateChanged, (const PlayerState& state), (override));
     MOCK_METHOD(void, OnGameStateChanged, (GameState state), (override));
-    MOCK_METHOD(void, OnGhostsUpdated, (const std::vector<GhostState>& ghosts), (override));
+    MOCK_METHOD(void, OnGhostsUpdated, (std::span<const GhostState> ghosts), (override));
     MOCK_METHOD(void, OnGhostModeChanged, (GhostMode mode), (override));
 };
 
@@ -20,6 +20,7 @@ public:
     MOCK_METHOD(void, StartNewGame, (), (override));
     MOCK_METHOD(void, Update, (float deltaTime), (override));
     MOCK_METHOD(void, SetPaused, (bool isPaused), (override));
+    MOCK_METHOD(void, TogglePaused, (), (override));
     MOCK_METHOD(void, SetPlayerDirection, (Direction direction), (override));
 
     MOCK_METHOD(GameState, GetState, (), (const, override));
@@ -30,9 +31,20 @@ public:
     MOCK_METHOD(int, GetPelletCount, (), (const, override));
     MOCK_METHOD(std::vector<GhostState>, GetGhostStates, (), (const, override));
     MOCK_METHOD(GhostMode, GetGlobalGhostMode, (), (const, override));
+    MOCK_METHOD(void, SaveSnapshot, (EngineSnapshot& snapshot), (const, override));
+    MOCK_METHOD(bool, RestoreSnapshot, (const EngineSnapshot& snapshot), (override));
+    MOCK_METHOD(std::shared_ptr<IGameEngine>, Clone, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<const DistanceTable>, GetDistanceTable, (MazeGraph::Mover mover), (const, override));
+    MOCK_METHOD(bool, LoadLevel, (std::shared_ptr<const LevelPack> pack, uint32_t index), (override));
+    MOCK_METHOD(uint32_t, GetLevelIndex, (), (const, override));
+    MOCK_METHOD(void, SetGhostAI, (GhostType type, std::shared_ptr<const IGhost> ai), (override));
+    MOCK_METHOD(void, SetKeyframeInterval, (uint32_t ticks), (override));
+    MOCK_METHOD(uint64_t, GetSeed, (), (const, override));
 
     MOCK_METHOD(void, AddListener, (std::shared_ptr<IEventListener> listener), (override));
     MOCK_METHOD(void, RemoveListener, (std::shared_ptr<IEventListener> listener), (override));
+    MOCK_METHOD(void, AddFrameListener, (std::shared_ptr<IFrameListener> listener), (override));
+    MOCK_METHOD(void, RemoveFrameListener, (std::shared_ptr<IFrameListener> listener), (override));
 };
 
 class IGameEngineTest : public ::testing::Test {
@@ -321,6 +321,21 @@ TEST_F(IGhostTest, CreateOrangeAI_ReturnsNonNull) {
     EXPECT_NE(orangeAI, nullptr);
 }
 
+TEST_F(IGhostTest, OrangeAI_NearPlayer_RetreatsToItsScatterTarget) {
+    auto orangeAI = CreateOrangeAI();
+    GhostState orange;
+    orange.Type = GhostType::Orange;
+    orange.Position = Vector2{13, 20};
+    PlayerState player;
+    player.Position = Vector2{13, 26};
+
+    // ScatterTarget left at its default: the AI must not depend on the engine filling it in
+    EXPECT_EQ(orangeAI->CalculateChaseTarget(orange, player, blinkyPosition), orangeAI->GetScatterTarget());
+
+    orange.Position = Vector2{13, 5};
+    EXPECT_EQ(orangeAI->CalculateChaseTarget(orange, player, blinkyPosition), player.Position);
+}
+
 TEST_F(IGhostTest, CreateGhostAI_AllTypes_ReturnNonNull) {
     for (auto type : {GhostType::Red, GhostType::Pink,
                        GhostType::Blue, GhostType::Orange}) {
@@ -11,6 +11,7 @@ public:
     MOCK_METHOD(void, StartNewGame, (), (override));
     MOCK_METHOD(void, Update, (float deltaTime), (override));
     MOCK_METHOD(void, SetPaused, (bool isPaused), (override));
+    MOCK_METHOD(void, TogglePaused, (), (override));
     MOCK_METHOD(void, SetPlayerDirection, (Direction direction), (override));
 
     MOCK_METHOD(GameState, GetState, (), (const, override));
@@ -21,9 +22,20 @@ public:
     MOCK_METHOD(int, GetPelletCount, (), (const, override));
     MOCK_METHOD(std::vector<GhostState>, GetGhostStates, (), (const, override));
     MOCK_METHOD(GhostMode, GetGlobalGhostMode, (), (const, override));
+    MOCK_METHOD(void, SaveSnapshot, (EngineSnapshot& snapshot), (const, override));
+    MOCK_METHOD(bool, RestoreSnapshot, (const EngineSnapshot& snapshot), (override));
+    MOCK_METHOD(std::shared_ptr<IGameEngine>, Clone, (), (const, override));
+    MOCK_METHOD(std::shared_ptr<const DistanceTable>, GetDistanceTable, (MazeGraph::Mover mover), (const, override));
+    MOCK_METHOD(bool, LoadLevel, (std::shared_ptr<const LevelPack> pack, uint32_t index), (override));
+    MOCK_METHOD(uint32_t, GetLevelIndex, (), (const, override));
+    MOCK_METHOD(void, SetGhostAI, (GhostType type, std::shared_ptr<const IGhost> ai), (override));
+    MOCK_METHOD(void, SetKeyframeInterval, (uint32_t ticks), (override));
+    MOCK_METHOD(uint64_t, GetSeed, (), (const, override));
 
     MOCK_METHOD(void, AddListener, (std::shared_ptr<IEventListener> listener), (override));
     MOCK_METHOD(void, RemoveListener, (std::shared_ptr<IEventListener> listener), (override));
+    MOCK_METHOD(void, AddFrameListener, (std::shared_ptr<IFrameListener> listener), (override));
+    MOCK_METHOD(void, RemoveFrameListener, (std::shared_ptr<IFrameListener> listener), (override));
 };
 
 class InputControllerTest : public ::testing::Test {
@@ -247,6 +259,18 @@ TEST_F(InputControllerTest, UpperCaseW_SameAsLowerCase) {
     controller->ProcessEvent(event);
 }
 
+TEST_F(InputControllerTest, PKey_TogglesPauseEveryPress) {
+    sf::Event event;
+    event.type = sf::Event::KeyPressed;
+    event.key.code = sf::Keyboard::P;
+
+    // Two presses before the engine updates must both reach it
+    EXPECT_CALL(*mockEngine, TogglePaused()).Times(2);
+    EXPECT_CALL(*mockEngine, SetPaused(::testing::_)).Times(0);
+    controller->ProcessEvent(event);
+    controller->ProcessEvent(event);
+}
+
 TEST_F(InputControllerTest, UpKeys_MapToUpDirection) {
     EXPECT_CALL(*mockEngine, SetPlayerDirection(Direction::Up)).Times(2);
 
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include "IGameEngine.hpp"
+#include "LevelPack.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+using namespace Pacman;
+
+namespace {
+
+    /// @brief Records the level notifications and the player position sent after them
+    class LevelListener : public IEventListener {
+    public:
+        void OnTileUpdated(const TileUpdate&) override {}
+        void OnPlayerStateChanged(const PlayerState& state) override { Player = state; }
+        void OnGameStateChanged(GameState) override {}
+        void OnGhostsUpdated(std::span<const GhostState>) override {}
+        void OnLevelLoaded(uint32_t levelIndex) override { Loaded.push_back(levelIndex); }
+
+        std::vector<uint32_t> Loaded;
+        PlayerState Player{};
+    };
+
+    /// @brief Default maze with an empty top corridor and the player starting up there
+    LevelData MakeAlternateLevel() {
+        LevelRows rows = DefaultLevelRows;
+        rows[1] = "#            ##            #";
+        return MakeLevelData(ParseLevel(rows), {1, 1}, DefaultLevelData.GhostSpawns,
+                             DefaultLevelData.ScatterTargets, DefaultLevelData.GhostHouse,
+                             DefaultLevelData.GhostHouseDoor);
+    }
+
+}
+
+class LevelPackTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() /
+                ("cosmic_levelpack_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".pack"))
+                   .string();
+        levels = {DefaultLevelData, MakeAlternateLevel()};
+        ASSERT_TRUE(LevelPack::Write(path, levels));
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    std::string path;
+    std::vector<LevelData> levels;
+};
+
+TEST_F(LevelPackTest, BuiltIn_HoldsDefaultLevel) {
+    auto pack = LevelPack::BuiltIn();
+    ASSERT_NE(pack, nullptr);
+    EXPECT_FALSE(pack->IsMapped());
+    EXPECT_EQ(pack->GetLevelCount(), 1u);
+    EXPECT_EQ(pack->GetLevel(0).Image.Walls, DefaultLevel.Walls);
+    EXPECT_EQ(pack, LevelPack::BuiltIn());
+}
+
+TEST_F(LevelPackTest, Open_MapsWrittenLevels) {
+    auto pack = LevelPack::Open(path);
+    ASSERT_NE(pack, nullptr);
+    EXPECT_TRUE(pack->IsMapped());
+    ASSERT_EQ(pack->GetLevelCount(), 2u);
+
+    const LevelData& alternate = pack->GetLevel(1);
+    EXPECT_EQ(alternate.PlayerStart, (Vector2{1, 1}));
+    EXPECT_EQ(alternate.Image.Pellets, levels[1].Image.Pellets);
+    EXPECT_EQ(alternate.Image.PelletCount, DefaultLevel.PelletCount - 24);
+    EXPECT_EQ(pack->GetLevel(0).Image.Walls, DefaultLevel.Walls);
+}
+
+TEST_F(LevelPackTest, MappedDistanceTables_MatchBuiltTables) {
+    auto pack = LevelPack::Open(path);
+    ASSERT_NE(pack, nullptr);
+
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> pick(0, MazeGraph::TileCount - 1);
+    for (uint32_t level = 0; level < pack->GetLevelCount(); ++level) {
+        for (auto mover : {MazeGraph::Mover::Player, MazeGraph::Mover::Ghost, MazeGraph::Mover::EatenGhost}) {
+            DistanceTable built(levels[level], mover);
+            auto mapped = pack->GetDistanceTable(level, mover);
+            ASSERT_EQ(mapped->GetNodeCount(), built.GetNodeCount());
+            EXPECT_EQ(mapped->GetMover(), mover);
+            for (int i = 0; i < 1000; ++i) {
+                int from = pick(rng);
+                int to = pick(rng);
+                ASSERT_EQ(mapped->GetDistance(from, to), built.GetDistance(from, to));
+                ASSERT_EQ(mapped->GetNextHop(from, to), built.GetNextHop(from, to));
+            }
+        }
+    }
+}
+
+TEST_F(LevelPackTest, Open_RejectsMissingOrDamagedFiles) {
+    EXPECT_EQ(LevelPack::Open(path + ".missing"), nullptr);
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    EXPECT_EQ(LevelPack::Open(path), nullptr);
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a level pack";
+    EXPECT_EQ(LevelPack::Open(path), nullptr);
+}
+
+TEST_F(LevelPackTest, Open_RejectsOutOfRangeDirection) {
+    LevelData level = DefaultLevelData;
+    level.GhostSpawns[2].StartDirection = static_cast<Direction>(7);
+    ASSERT_TRUE(LevelPack::Write(path, std::span(&level, 1)));
+    EXPECT_EQ(LevelPack::Open(path), nullptr);
+
+    level = DefaultLevelData;
+    level.PlayerStartDirection = static_cast<Direction>(0xFF);
+    ASSERT_TRUE(LevelPack::Write(path, std::span(&level, 1)));
+    EXPECT_EQ(LevelPack::Open(path), nullptr);
+}
+
+TEST_F(LevelPackTest, Open_RejectsWrongPelletCount) {
+    LevelData level = DefaultLevelData;
+    level.Image.PelletCount += 1;
+    ASSERT_TRUE(LevelPack::Write(path, std::span(&level, 1)));
+    EXPECT_EQ(LevelPack::Open(path), nullptr);
+}
+
+TEST_F(LevelPackTest, LoadLevel_SwitchesMaze) {
+    auto pack = LevelPack::Open(path);
+    auto engine = CreateGameEngine(1);
+
+    ASSERT_TRUE(engine->LoadLevel(pack, 1));
+    EXPECT_EQ(engine->GetLevelIndex(), 1u);
+    EXPECT_EQ(engine->GetState(), GameState::Paused);
+    engine->StartNewGame();
+    EXPECT_EQ(engine->GetPlayerState().Position, (Vector2{1, 1}));
+    EXPECT_EQ(engine->GetPelletCount(), levels[1].Image.PelletCount);
+    EXPECT_EQ(engine->GetTileAt({1, 1}), TileType::Path);
+
+    ASSERT_TRUE(engine->LoadLevel(pack, 0));
+    engine->StartNewGame();
+    EXPECT_EQ(engine->GetPelletCount(), DefaultLevel.PelletCount);
+}
+
+TEST_F(LevelPackTest, LoadLevel_NotifiesListeners) {
+    auto pack = LevelPack::Open(path);
+    auto engine = CreateGameEngine(1);
+    auto listener = std::make_shared<LevelListener>();
+    engine->AddListener(listener);
+
+    ASSERT_TRUE(engine->LoadLevel(pack, 1));
+    EXPECT_EQ(listener->Loaded, std::vector<uint32_t>{1});
+    EXPECT_EQ(listener->Player.Position, (Vector2{1, 1}));
+
+    EXPECT_FALSE(engine->LoadLevel(pack, 2));
+    EXPECT_EQ(listener->Loaded.size(), 1u);
+}
+
+TEST_F(LevelPackTest, LoadLevel_RejectsUnknownLevel) {
+    auto engine = CreateGameEngine(1);
+    EXPECT_FALSE(engine->LoadLevel(nullptr, 0));
+    EXPECT_FALSE(engine->LoadLevel(LevelPack::Open(path), 2));
+    EXPECT_EQ(engine->GetLevelIndex(), 0u);
+}
+
+TEST_F(LevelPackTest, Engines_ShareOneMapping) {
+    auto pack = LevelPack::Open(path);
+    auto first = CreateGameEngine(1);
+    auto second = CreateGameEngine(2);
+    first->LoadLevel(pack, 1);
+    second->LoadLevel(pack, 1);
+
+    auto table = first->GetDistanceTable(MazeGraph::Mover::Ghost);
+    EXPECT_EQ(table, second->GetDistanceTable(MazeGraph::Mover::Ghost));
+    EXPECT_EQ(table, pack->GetDistanceTable(1, MazeGraph::Mover::Ghost));
+
+    // Engines and tables keep the mapping alive on their own
+    pack.reset();
+    first.reset();
+    second->StartNewGame();
+    for (int i = 0; i < 600; ++i) second->Update(1.0f / 60.0f);
+    EXPECT_GT(table->GetNodeCount(), 0);
+}
+
+TEST_F(LevelPackTest, MappedDefaultLevel_PlaysLikeBuiltIn) {
+    auto builtIn = CreateGameEngine(9);
+    auto mapped = CreateGameEngine(9);
+    ASSERT_TRUE(mapped->LoadLevel(LevelPack::Open(path), 0));
+    builtIn->StartNewGame();
+    mapped->StartNewGame();
+
+    constexpr Direction Inputs[] = {Direction::Up, Direction::Left, Direction::Down, Direction::Right};
+    for (int tick = 0; tick < 3000; ++tick) {
+        if (tick % 45 == 0) {
+            builtIn->SetPlayerDirection(Inputs[(tick / 45) % 4]);
+            mapped->SetPlayerDirection(Inputs[(tick / 45) % 4]);
+        }
+        builtIn->Update(1.0f / 60.0f);
+        mapped->Update(1.0f / 60.0f);
+    }
+    EXPECT_EQ(mapped->GetPlayerState().Position, builtIn->GetPlayerState().Position);
+    EXPECT_EQ(mapped->GetPlayerState().Score, builtIn->GetPlayerState().Score);
+    EXPECT_EQ(mapped->GetState(), builtIn->GetState());
+}
+
+TEST_F(LevelPackTest, Snapshot_RestoresLevel) {
+    auto pack = LevelPack::Open(path);
+    auto source = CreateGameEngine(4);
+    source->LoadLevel(pack, 1);
+    source->StartNewGame();
+
+    EngineSnapshot snapshot;
+    source->SaveSnapshot(snapshot);
+    EXPECT_EQ(snapshot.LevelIndex, 1u);
+
+    auto target = CreateGameEngine(4);
+    target->LoadLevel(pack, 0);
+    EXPECT_TRUE(target->RestoreSnapshot(snapshot));
+    EXPECT_EQ(target->GetLevelIndex(), 1u);
+    EXPECT_EQ(target->GetPlayerState().Position, (Vector2{1, 1}));
+    EXPECT_EQ(target->GetDistanceTable(MazeGraph::Mover::Player), pack->GetDistanceTable(1, MazeGraph::Mover::Player));
+}
+
+TEST_F(LevelPackTest, Snapshot_FromOtherPack_IsRejected) {
+    auto pack = LevelPack::Open(path);
+    auto source = CreateGameEngine(4);
+    source->LoadLevel(pack, 1);
+    source->StartNewGame();
+    EngineSnapshot snapshot;
+    source->SaveSnapshot(snapshot);
+
+    // The built-in pack has no level 1, so nothing may change
+    auto target = CreateGameEngine(4);
+    target->StartNewGame();
+    PlayerState before = target->GetPlayerState();
+    EXPECT_FALSE(target->RestoreSnapshot(snapshot));
+    EXPECT_EQ(target->GetLevelIndex(), 0u);
+    EXPECT_EQ(target->GetPlayerState().Position, before.Position);
+    EXPECT_EQ(target->GetPelletCount(), DefaultLevel.PelletCount);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "MazeGraph.hpp"
+
+using namespace Pacman;
+
+namespace {
+
+    constexpr Direction AllDirections[] = {Direction::Up, Direction::Down, Direction::Left, Direction::Right};
+
+}
+
+namespace {
+
+    void ExpectExitsMatchMap(const Map& map, const MazeGraph::HouseArea& houseArea) {
+        MazeGraph graph(map, houseArea);
+        for (int tile = 0; tile < MazeGraph::TileCount; ++tile) {
+            Vector2 pos = MazeGraph::ToPosition(tile);
+            bool nearHouse = houseArea.Contains(pos);
+            for (Direction dir : AllDirections) {
+                Vector2 next = map.WrapPosition(pos + GetDirectionDelta(dir));
+                uint8_t bit = MazeGraph::ExitBit(dir);
+                EXPECT_EQ((graph.GetPlayerExits(tile) & bit) != 0, map.IsWalkable(next));
+                EXPECT_EQ((graph.GetGhostExits(tile) & bit) != 0, map.IsGhostWalkable(next, nearHouse));
+                EXPECT_EQ((graph.GetEatenExits(tile) & bit) != 0, map.IsGhostWalkable(next, true));
+            }
+        }
+    }
+
+}
+
+TEST(MazeGraphTest, HouseArea_ContainsIsInclusive) {
+    constexpr MazeGraph::HouseArea area = {{10, 12}, {17, 16}};
+    EXPECT_TRUE(area.Contains({10, 12}));
+    EXPECT_TRUE(area.Contains({17, 16}));
+    EXPECT_TRUE(area.Contains({13, 14}));
+    EXPECT_FALSE(area.Contains({9, 12}));
+    EXPECT_FALSE(area.Contains({18, 16}));
+    EXPECT_FALSE(area.Contains({10, 11}));
+    EXPECT_FALSE(area.Contains({17, 17}));
+}
+
+TEST(MazeGraphTest, ExitMasks_MatchMapWalkability) {
+    ExpectExitsMatchMap(Map(), MazeGraph::DefaultHouseArea);
+}
+
+TEST(MazeGraphTest, ExitMasks_FollowGivenHouseArea) {
+    // Only the tile right above the door may enter; the house itself is shut
+    ExpectExitsMatchMap(Map(), {{13, 11}, {13, 11}});
+
+    MazeGraph graph(Map(), {{13, 11}, {13, 11}});
+    int aboveDoor = MazeGraph::ToIndex({13, 11});
+    int besideDoor = MazeGraph::ToIndex({14, 11});
+    EXPECT_TRUE(graph.GetGhostExits(aboveDoor) & MazeGraph::ExitBit(Direction::Down));
+    EXPECT_FALSE(graph.GetGhostExits(besideDoor) & MazeGraph::ExitBit(Direction::Down));
+}
+
+TEST(MazeGraphTest, Neighbors_WrapThroughTunnel) {
+    MazeGraph graph{Map()};
+    int leftEdge = MazeGraph::ToIndex({0, 14});
+    int rightEdge = MazeGraph::ToIndex({MazeGraph::Width - 1, 14});
+
+    EXPECT_EQ(graph.GetNeighbor(leftEdge, Direction::Left), rightEdge);
+    EXPECT_EQ(graph.GetNeighbor(rightEdge, Direction::Right), leftEdge);
+    EXPECT_TRUE(graph.GetPlayerExits(leftEdge) & MazeGraph::ExitBit(Direction::Left));
+}
+
+TEST(MazeGraphTest, GhostDoor_OnlyOpenNearHouseOrWhenEaten) {
+    MazeGraph graph{Map()};
+    int aboveDoor = MazeGraph::ToIndex({13, 11});
+
+    EXPECT_FALSE(graph.GetPlayerExits(aboveDoor) & MazeGraph::ExitBit(Direction::Down));
+    EXPECT_TRUE(graph.GetEatenExits(aboveDoor) & MazeGraph::ExitBit(Direction::Down));
+}
@@ -0,0 +1,323 @@
+#include <gtest/gtest.h>
+#include "CompactSnapshot.hpp"
+#include "IGameEngine.hpp"
+#include "Replay.hpp"
+#include "ReplayPlayer.hpp"
+#include "ReplayRecorder.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace Pacman;
+
+namespace {
+
+    /// @brief Keeps every logged entry in memory
+    class LogCollector : public IEventListener {
+    public:
+        void OnTileUpdated(const TileUpdate&) override {}
+        void OnPlayerStateChanged(const PlayerState&) override {}
+        void OnGameStateChanged(GameState) override {}
+        void OnGhostsUpdated(std::span<const GhostState>) override {}
+        void OnInputLogged(const InputLogEntry& entry) override { Entries.push_back(entry); }
+
+        std::vector<InputLogEntry> Entries;
+    };
+
+    /// @brief Play until the game ends with changing inputs, a pause and a frame-time change
+    void PlayGame(IGameEngine& engine, uint32_t inputs) {
+        engine.StartNewGame();
+        for (uint32_t tick = 0; engine.GetState() != GameState::GameOver &&
+                                engine.GetState() != GameState::Victory; ++tick) {
+            if (tick % 6 == 0) {
+                inputs = inputs * 1664525u + 1013904223u;
+                engine.SetPlayerDirection(static_cast<Direction>(inputs >> 30));
+            }
+            if (tick == 100) engine.SetPaused(true);
+            if (tick == 130) engine.SetPaused(false);
+            engine.Update(tick < 500 ? 1.0f / 60.0f : 1.0f / 50.0f);
+        }
+    }
+
+    void ExpectSameState(const IGameEngine& expected, const IGameEngine& actual) {
+        EngineSnapshot a;
+        EngineSnapshot b;
+        expected.SaveSnapshot(a);
+        actual.SaveSnapshot(b);
+        EXPECT_EQ(a.State, b.State);
+        EXPECT_EQ(a.Player.Position, b.Player.Position);
+        EXPECT_EQ(a.Player.Score, b.Player.Score);
+        EXPECT_EQ(a.Player.Lives, b.Player.Lives);
+        EXPECT_EQ(a.Board.GetPellets(), b.Board.GetPellets());
+        for (size_t i = 0; i < a.Ghosts.size(); ++i) {
+            EXPECT_EQ(a.Ghosts[i].Position, b.Ghosts[i].Position);
+        }
+        EXPECT_EQ(a.Rng, b.Rng);
+        EXPECT_EQ(a.Tick, b.Tick);
+    }
+
+}
+
+class ReplayTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() /
+                ("cosmic_replay_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".replay"))
+                   .string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    std::string path;
+};
+
+TEST(InputLogTest, LogsOnlyChanges) {
+    auto engine = CreateGameEngine(3);
+    auto log = std::make_shared<LogCollector>();
+    engine->AddListener(log);
+    engine->StartNewGame();
+
+    engine->SetPlayerDirection(Direction::Left);  // already the start direction
+    engine->Update(1.0f / 60.0f);
+    engine->SetPlayerDirection(Direction::Up);
+    engine->Update(1.0f / 60.0f);
+    engine->SetPlayerDirection(Direction::Up);
+    engine->SetPaused(false);                     // already running
+    engine->Update(1.0f / 60.0f);
+
+    ASSERT_EQ(log->Entries.size(), 3u);
+    EXPECT_EQ(log->Entries[0].Type, InputLogType::GameStarted);
+    EXPECT_EQ(log->Entries[0].Seed, 3u);
+    EXPECT_EQ(log->Entries[1].Type, InputLogType::DeltaTime);
+    EXPECT_EQ(log->Entries[1].Tick, 0u);
+    EXPECT_EQ(log->Entries[2].Type, InputLogType::Direction);
+    EXPECT_EQ(log->Entries[2].Tick, 1u);
+    EXPECT_EQ(log->Entries[2].Input, Direction::Up);
+}
+
+TEST(ReplayFormatTest, EncodeDecode_RoundTrips) {
+    std::vector<uint8_t> data;
+    ReplayEncoder::EncodeHeader(data);
+    ReplayEncoder encoder;
+    encoder.Encode({.Type = InputLogType::GameStarted, .Seed = 1ull << 40, .LevelIndex = 2}, data);
+    encoder.Encode({.Type = InputLogType::DeltaTime, .Tick = 0, .DeltaTime = 0.02f}, data);
+    encoder.Encode({.Type = InputLogType::Direction, .Tick = 5, .Input = Direction::Right}, data);
+    encoder.Encode({.Type = InputLogType::Paused, .Tick = 300}, data);
+    encoder.Encode({.Type = InputLogType::Resumed, .Tick = 70000}, data);
+    encoder.Encode({.Type = InputLogType::GameEnded, .Tick = 70010, .State = GameState::GameOver,
+                    .Player = {.Position = {13, 26}, .Score = 1230, .Lives = 0}, .PelletCount = 17}, data);
+
+    std::vector<Replay> replays = DecodeReplays(data);
+    ASSERT_EQ(replays.size(), 1u);
+    const Replay& replay = replays[0];
+    EXPECT_EQ(replay.Seed, 1ull << 40);
+    EXPECT_EQ(replay.LevelIndex, 2u);
+    ASSERT_EQ(replay.Entries.size(), 4u);
+    EXPECT_EQ(replay.Entries[0].DeltaTime, 0.02f);
+    EXPECT_EQ(replay.Entries[1].Tick, 5u);
+    EXPECT_EQ(replay.Entries[1].Input, Direction::Right);
+    EXPECT_EQ(replay.Entries[2].Type, InputLogType::Paused);
+    EXPECT_EQ(replay.Entries[2].Tick, 300u);
+    EXPECT_EQ(replay.Entries[3].Type, InputLogType::Resumed);
+    EXPECT_EQ(replay.Entries[3].Tick, 70000u);
+    ASSERT_TRUE(replay.End);
+    EXPECT_EQ(replay.End->Tick, 70010u);
+    EXPECT_EQ(replay.End->State, GameState::GameOver);
+    EXPECT_EQ(replay.End->Player.Score, 1230);
+    EXPECT_EQ(replay.End->Player.Position, (Vector2{13, 26}));
+    EXPECT_EQ(replay.End->PelletCount, 17);
+
+    // Cut off mid-entry: the game survives without its end
+    data.resize(data.size() - 3);
+    replays = DecodeReplays(data);
+    ASSERT_EQ(replays.size(), 1u);
+    EXPECT_FALSE(replays[0].End);
+    EXPECT_EQ(replays[0].Entries.size(), 4u);
+
+    data[0] = 'X';
+    EXPECT_TRUE(DecodeReplays(data).empty());
+}
+
+TEST(ReplayFormatTest, Keyframes_RoundTripAndOldVersionsStillDecode) {
+    std::vector<uint8_t> data;
+    ReplayEncoder::EncodeHeader(data);
+    ReplayEncoder encoder;
+    encoder.Encode({.Type = InputLogType::GameStarted, .Seed = 4}, data);
+    encoder.Encode({.Type = InputLogType::Direction, .Tick = 3, .Input = Direction::Up}, data);
+    encoder.EncodeKeyframe({.Tick = 600, .DeltaTime = 0.02f, .State = {1, 2, 3}}, data);
+    encoder.Encode({.Type = InputLogType::Direction, .Tick = 600, .Input = Direction::Down}, data);
+
+    std::vector<Replay> replays = DecodeReplays(data);
+    ASSERT_EQ(replays.size(), 1u);
+    ASSERT_EQ(replays[0].Keyframes.size(), 1u);
+    EXPECT_EQ(replays[0].Keyframes[0].Tick, 600u);
+    EXPECT_EQ(replays[0].Keyframes[0].DeltaTime, 0.02f);
+    EXPECT_EQ(replays[0].Keyframes[0].State, (std::vector<uint8_t>{1, 2, 3}));
+    ASSERT_EQ(replays[0].Entries.size(), 2u);
+    EXPECT_EQ(replays[0].Entries[1].Tick, 600u);
+
+    // Version 1 streams are the same without keyframes
+    std::vector<uint8_t> old(std::begin(ReplayEncoder::Magic), std::end(ReplayEncoder::Magic));
+    old.push_back(1);
+    ReplayEncoder oldEncoder;
+    oldEncoder.Encode({.Type = InputLogType::GameStarted, .Seed = 4}, old);
+    oldEncoder.Encode({.Type = InputLogType::Direction, .Tick = 3, .Input = Direction::Up}, old);
+    replays = DecodeReplays(old);
+    ASSERT_EQ(replays.size(), 1u);
+    EXPECT_EQ(replays[0].Entries.size(), 1u);
+
+    old[sizeof(ReplayEncoder::Magic)] = ReplayEncoder::FormatVersion + 1;
+    EXPECT_TRUE(DecodeReplays(old).empty());
+}
+
+TEST(CompactSnapshotTest, RoundTrip_ContinuesIdentically) {
+    auto original = CreateGameEngine(21);
+    original->StartNewGame();
+    for (int i = 0; i < 900; ++i) {
+        if (i % 40 == 0) original->SetPlayerDirection(static_cast<Direction>(i / 40 % 4));
+        original->Update(1.0f / 60.0f);
+    }
+
+    EngineSnapshot snapshot;
+    original->SaveSnapshot(snapshot);
+    const LevelData& level = LevelPack::BuiltIn()->GetLevel(0);
+    std::vector<uint8_t> data;
+    EncodeCompactSnapshot(snapshot, level, data);
+    EXPECT_LT(data.size(), 200u);
+
+    EngineSnapshot decoded;
+    ASSERT_TRUE(DecodeCompactSnapshot(data, level, decoded));
+    auto restored = CreateGameEngine(0);
+    restored->RestoreSnapshot(decoded);
+    ExpectSameState(*original, *restored);
+    for (int i = 0; i < 600; ++i) {
+        original->Update(1.0f / 60.0f);
+        restored->Update(1.0f / 60.0f);
+    }
+    ExpectSameState(*original, *restored);
+
+    data.pop_back();
+    EXPECT_FALSE(DecodeCompactSnapshot(data, level, decoded));
+}
+
+TEST_F(ReplayTest, RecordedGames_ReplayToIdenticalStates) {
+    std::vector<std::shared_ptr<IGameEngine>> originals;
+    {
+        auto recorder = std::make_shared<ReplayRecorder>(path);
+        ASSERT_TRUE(recorder->IsOpen());
+        for (uint32_t i = 0; i < 3; ++i) {
+            auto engine = CreateGameEngine(40 + i);
+            engine->AddListener(recorder);
+            PlayGame(*engine, 11 + i);
+            engine->RemoveListener(recorder);
+            originals.push_back(engine);
+        }
+    }
+
+    std::vector<Replay> replays = LoadReplays(path);
+    ASSERT_EQ(replays.size(), 3u);
+    for (size_t i = 0; i < replays.size(); ++i) {
+        EXPECT_EQ(replays[i].Seed, 40u + i);
+        ASSERT_TRUE(replays[i].End);
+
+        ReplayPlayer player(replays[i]);
+        ASSERT_TRUE(player.IsValid());
+        player.RunToEnd();
+        EXPECT_TRUE(player.MatchesRecordedEnd());
+        ExpectSameState(*originals[i], player.GetEngine());
+    }
+}
+
+TEST_F(ReplayTest, Player_MatchesOriginalAtEveryTick) {
+    auto log = std::make_shared<LogCollector>();
+    auto engine = CreateGameEngine(9);
+    engine->AddListener(log);
+    engine->StartNewGame();
+
+    // Stop early, so the end is filled in from the last frame
+    uint32_t inputs = 5;
+    std::vector<EngineSnapshot> frames;
+    for (uint32_t tick = 0; tick < 600 && engine->GetState() != GameState::GameOver; ++tick) {
+        if (tick % 6 == 0) {
+            inputs = inputs * 1664525u + 1013904223u;
+            engine->SetPlayerDirection(static_cast<Direction>(inputs >> 30));
+        }
+        engine->Update(1.0f / 60.0f);
+        engine->SaveSnapshot(frames.emplace_back());
+    }
+    Replay replay;
+    replay.Seed = 9;
+    for (const InputLogEntry& entry : log->Entries) {
+        if (entry.Type != InputLogType::GameStarted) replay.Entries.push_back(entry);
+    }
+    replay.End = InputLogEntry{.Type = InputLogType::GameEnded, .Tick = static_cast<uint32_t>(frames.size()),
+                               .State = frames.back().State, .Player = frames.back().Player,
+                               .PelletCount = frames.back().Board.GetPelletCount()};
+
+    ReplayPlayer recorded(replay);
+    recorded.RunToEnd();
+    EXPECT_TRUE(recorded.MatchesRecordedEnd());
+    for (uint32_t tick : {1u, 250u, 17u, static_cast<uint32_t>(frames.size() - 1)}) {
+        recorded.SeekTo(tick);
+        ASSERT_EQ(recorded.GetTick(), tick);
+        EngineSnapshot snapshot;
+        recorded.GetEngine().SaveSnapshot(snapshot);
+        EXPECT_EQ(snapshot.Player.Position, frames[tick - 1].Player.Position) << "tick " << tick;
+        EXPECT_EQ(snapshot.Ghosts[0].Position, frames[tick - 1].Ghosts[0].Position) << "tick " << tick;
+        EXPECT_EQ(snapshot.Rng, frames[tick - 1].Rng) << "tick " << tick;
+    }
+}
+
+TEST_F(ReplayTest, Seek_MatchesSequentialPlayFromNearestKeyframe) {
+    {
+        auto recorder = std::make_shared<ReplayRecorder>(path);
+        auto engine = CreateGameEngine(63);
+        engine->AddListener(recorder);
+        PlayGame(*engine, 2);
+    }
+    auto replays = LoadReplays(path);
+    ASSERT_EQ(replays.size(), 1u);
+    ASSERT_TRUE(replays[0].End);
+    uint32_t length = replays[0].End->Tick;
+    ASSERT_GT(length, 3 * IGameEngine::DefaultKeyframeInterval);
+    EXPECT_EQ(replays[0].Keyframes.size(), (length - 1) / IGameEngine::DefaultKeyframeInterval);
+
+    Replay plain = replays[0];
+    plain.Keyframes.clear();
+    ReplayPlayer sequential(plain);
+    ReplayPlayer seeking(replays[0]);
+    std::vector<uint32_t> targets = {length - 5, 130, IGameEngine::DefaultKeyframeInterval * 2,
+                                     IGameEngine::DefaultKeyframeInterval * 2 + 40, length / 2, 7, length};
+    for (uint32_t target : targets) {
+        if (target < sequential.GetTick()) sequential.Rewind();
+        sequential.SeekTo(target);
+
+        uint64_t before = seeking.GetTicksSimulated();
+        seeking.SeekTo(target);
+        ASSERT_EQ(seeking.GetTick(), target);
+        EXPECT_LT(seeking.GetTicksSimulated() - before, IGameEngine::DefaultKeyframeInterval) << "tick " << target;
+        ExpectSameState(sequential.GetEngine(), seeking.GetEngine());
+    }
+    EXPECT_TRUE(seeking.MatchesRecordedEnd());
+}
+
+TEST_F(ReplayTest, RandomGame_FitsInAFewKilobytes) {
+    {
+        auto recorder = std::make_shared<ReplayRecorder>(path);
+        auto engine = CreateGameEngine(77);
+        engine->SetKeyframeInterval(0);
+        engine->AddListener(recorder);
+        PlayGame(*engine, 3);
+    }
+    auto replays = LoadReplays(path);
+    ASSERT_EQ(replays.size(), 1u);
+    ASSERT_TRUE(replays[0].End);
+    EXPECT_TRUE(replays[0].Keyframes.empty());
+
+    // A new direction every 6 ticks is busier than a human; scale to 10 minutes at 60 Hz
+    double bytesPerTick = static_cast<double>(std::filesystem::file_size(path)) / replays[0].End->Tick;
+    EXPECT_LT(bytesPerTick * 36000.0, 8192.0);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "IGameEngine.hpp"
+#include "TickProfiler.hpp"
+
+#include <sstream>
+#include <thread>
+
+using namespace Pacman;
+
+namespace {
+
+    uint64_t CountOf(const TickProfiler::Histograms& histograms, TickPhase phase) {
+        return histograms[static_cast<size_t>(phase)].GetCount();
+    }
+
+}
+
+TEST(LatencyHistogramTest, Buckets_CoverEveryValueWithBoundedError) {
+    for (uint64_t value : {uint64_t{0}, uint64_t{1}, uint64_t{31}, uint64_t{32}, uint64_t{33}, uint64_t{1000},
+                           uint64_t{123456789}, UINT64_MAX}) {
+        size_t bucket = LatencyHistogram::BucketOf(value);
+        ASSERT_LT(bucket, LatencyHistogram::BucketCount);
+        EXPECT_LE(LatencyHistogram::LowestValueOf(bucket), value);
+        EXPECT_GE(LatencyHistogram::HighestValueOf(bucket), value);
+        uint64_t width = LatencyHistogram::HighestValueOf(bucket) - LatencyHistogram::LowestValueOf(bucket);
+        EXPECT_LE(width, value / 16) << value;
+    }
+    for (size_t bucket = 0; bucket + 1 < LatencyHistogram::BucketCount; ++bucket) {
+        ASSERT_EQ(LatencyHistogram::HighestValueOf(bucket) + 1, LatencyHistogram::LowestValueOf(bucket + 1));
+    }
+}
+
+TEST(LatencyHistogramTest, Percentiles_FollowTheDistribution) {
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 1000; ++value) histogram.Add(value);
+    histogram.Add(1000000);
+
+    EXPECT_EQ(histogram.GetCount(), 1001u);
+    EXPECT_EQ(histogram.GetMin(), 1u);
+    EXPECT_EQ(histogram.GetMax(), 1000000u);
+    EXPECT_NEAR(static_cast<double>(histogram.GetValueAtPercentile(50.0)), 500.0, 500.0 / 16);
+    EXPECT_NEAR(static_cast<double>(histogram.GetValueAtPercentile(99.0)), 990.0, 990.0 / 16);
+    EXPECT_EQ(histogram.GetValueAtPercentile(100.0), 1000000u);
+
+    LatencyHistogram other;
+    other.Add(5, 9);
+    histogram.Merge(other);
+    EXPECT_EQ(histogram.GetCount(), 1010u);
+    EXPECT_EQ(histogram.GetBucket(LatencyHistogram::BucketOf(5)), 10u);
+}
+
+TEST(TickProfilerTest, Update_RecordsEveryPhaseOnlyWhenCompiledIn) {
+    TickProfiler::Reset();
+    auto engine = CreateGameEngine(1);
+    engine->StartNewGame();
+    for (int tick = 0; tick < 120; ++tick) engine->Update(1.0f / 60.0f);
+
+    TickProfiler::Histograms histograms = TickProfiler::Collect();
+    if (!TickProfiler::IsEnabled()) {
+        for (const LatencyHistogram& histogram : histograms) EXPECT_EQ(histogram.GetCount(), 0u);
+        return;
+    }
+    EXPECT_EQ(CountOf(histograms, TickPhase::Update), 120u);
+    EXPECT_EQ(CountOf(histograms, TickPhase::ModeController), 120u);
+    EXPECT_EQ(CountOf(histograms, TickPhase::Player), 120u);
+    EXPECT_EQ(CountOf(histograms, TickPhase::Ghosts), 120u);
+    EXPECT_EQ(CountOf(histograms, TickPhase::Collisions), 120u);
+    EXPECT_GT(CountOf(histograms, TickPhase::Notification), 0u);
+
+    std::ostringstream report;
+    TickProfiler::Dump(report);
+    EXPECT_NE(report.str().find("Ghosts"), std::string::npos);
+}
+
+TEST(TickProfilerTest, Collect_KeepsExactTotalsOfExitedThreads) {
+    TickProfiler::Reset();
+    std::thread worker([] {
+        TickProfiler::Record(TickPhase::Player, 1000);
+        TickProfiler::Record(TickPhase::Player, 1003);
+        TickProfiler::Record(TickPhase::Player, 2047);
+    });
+    worker.join();
+
+    // 1003 and 2047 share buckets with other values, so a bucket-based estimate would be off
+    TickProfiler::Histograms histograms = TickProfiler::Collect();
+    const LatencyHistogram& player = histograms[static_cast<size_t>(TickPhase::Player)];
+    EXPECT_EQ(player.GetCount(), 3u);
+    EXPECT_EQ(player.GetSum(), 4050u);
+    EXPECT_EQ(player.GetMin(), 1000u);
+    EXPECT_EQ(player.GetMax(), 2047u);
+
+    TickProfiler::Reset();
+    EXPECT_EQ(CountOf(TickProfiler::Collect(), TickPhase::Player), 0u);
+}